@@ -90,6 +90,32 @@ void main() {
     gl_Position = outPos;
 }
 )";
+static const char* shader_vert_glyph = RMLUI_SHADER_HEADER R"(
+uniform vec2 _translate;
+uniform mat4 _transform;
+uniform vec4 _color;
+
+in vec2 inGlyphPosition;
+in vec2 inGlyphSize;
+in vec4 inGlyphTexCoords;
+in vec4 inGlyphColor;
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+
+void main() {
+	// Expand each instance into a quad drawn as a triangle strip, the vertex index selects the corner.
+	vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+
+	fragTexCoord = mix(inGlyphTexCoords.xy, inGlyphTexCoords.zw, corner);
+	fragColor = inGlyphColor * _color;
+
+	vec2 translatedPos = inGlyphPosition + corner * inGlyphSize + _translate;
+	vec4 outPos = _transform * vec4(translatedPos, 0.0, 1.0);
+
+    gl_Position = outPos;
+}
+)";
 static const char* shader_frag_texture = RMLUI_SHADER_HEADER R"(
 uniform sampler2D _tex;
 in vec2 fragTexCoord;
@@ -318,12 +344,14 @@ enum class ProgramId {
 	BlendMask,
 	Blur,
 	DropShadow,
+	Glyph,
 	Count,
 };
 enum class VertShaderId {
 	Main,
 	Passthrough,
 	Blur,
+	Glyph,
 	Count,
 };
 enum class FragShaderId {
@@ -366,8 +394,9 @@ static const char* const program_uniform_names[(size_t)UniformId::Count] = {"_tr
 	"_texelOffset", "_texCoordMin", "_texCoordMax", "_texMask", "_weights[0]", "_func", "_p", "_v", "_stop_colors[0]", "_stop_positions[0]",
 	"_num_stops", "_value", "_dimensions"};
 
-enum class VertexAttribute { Position, Color0, TexCoord0, Count };
-static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count] = {"inPosition", "inColor0", "inTexCoord0"};
+enum class VertexAttribute { Position, Color0, TexCoord0, GlyphPosition, GlyphSize, GlyphTexCoords, GlyphColor, Count };
+static const char* const vertex_attribute_names[(size_t)VertexAttribute::Count] = {"inPosition", "inColor0", "inTexCoord0", "inGlyphPosition",
+	"inGlyphSize", "inGlyphTexCoords", "inGlyphColor"};
 
 struct VertShaderDefinition {
 	VertShaderId id;
@@ -391,6 +420,7 @@ static const VertShaderDefinition vert_shader_definitions[] = {
 	{VertShaderId::Main,        "main",         shader_vert_main},
 	{VertShaderId::Passthrough, "passthrough",  shader_vert_passthrough},
 	{VertShaderId::Blur,        "blur",         shader_vert_blur},
+	{VertShaderId::Glyph,       "glyph",        shader_vert_glyph},
 };
 static const FragShaderDefinition frag_shader_definitions[] = {
 	{FragShaderId::Color,       "color",        shader_frag_color},
@@ -413,6 +443,7 @@ static const ProgramDefinition program_definitions[] = {
 	{ProgramId::BlendMask,   "blend_mask",   VertShaderId::Passthrough, FragShaderId::BlendMask},
 	{ProgramId::Blur,        "blur",         VertShaderId::Blur,        FragShaderId::Blur},
 	{ProgramId::DropShadow,  "drop_shadow",  VertShaderId::Passthrough, FragShaderId::DropShadow},
+	{ProgramId::Glyph,       "glyph",        VertShaderId::Glyph,       FragShaderId::Texture},
 };
 // clang-format on
 
@@ -471,6 +502,12 @@ struct CompiledGeometryData {
 	GLsizei draw_count;
 };
 
+struct CompiledGlyphInstancesData {
+	GLuint vao;
+	GLuint vbo;
+	GLsizei num_instances;
+};
+
 struct FramebufferData {
 	int width, height;
 	GLuint framebuffer;
@@ -1759,6 +1796,80 @@ void RenderInterface_GL3::ReleaseShader(Rml::CompiledShaderHandle shader_handle)
 	delete reinterpret_cast<CompiledShader*>(shader_handle);
 }
 
+bool RenderInterface_GL3::IsGlyphInstancingSupported()
+{
+	return true;
+}
+
+Rml::CompiledGeometryHandle RenderInterface_GL3::CompileGlyphInstances(Rml::Span<const Rml::GlyphInstance> instances)
+{
+	GLuint vao = 0;
+	GLuint vbo = 0;
+
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &vbo);
+	glBindVertexArray(vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::GlyphInstance) * instances.size(), (const void*)instances.data(), GL_STATIC_DRAW);
+
+	// Every attribute is sourced once per instance, the vertices of each quad are generated by the vertex shader.
+	auto SetInstanceAttribute = [](Gfx::VertexAttribute attribute, GLint size, GLenum type, GLboolean normalized, size_t offset) {
+		glEnableVertexAttribArray((GLuint)attribute);
+		glVertexAttribPointer((GLuint)attribute, size, type, normalized, sizeof(Rml::GlyphInstance), (const GLvoid*)offset);
+		glVertexAttribDivisor((GLuint)attribute, 1);
+	};
+
+	SetInstanceAttribute(Gfx::VertexAttribute::GlyphPosition, 2, GL_FLOAT, GL_FALSE, offsetof(Rml::GlyphInstance, position));
+	SetInstanceAttribute(Gfx::VertexAttribute::GlyphSize, 2, GL_FLOAT, GL_FALSE, offsetof(Rml::GlyphInstance, size));
+	SetInstanceAttribute(Gfx::VertexAttribute::GlyphTexCoords, 4, GL_FLOAT, GL_FALSE, offsetof(Rml::GlyphInstance, tex_coords));
+	SetInstanceAttribute(Gfx::VertexAttribute::GlyphColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(Rml::GlyphInstance, colour));
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	Gfx::CheckGLError("CompileGlyphInstances");
+
+	Gfx::CompiledGlyphInstancesData* glyph_instances = new Gfx::CompiledGlyphInstancesData;
+	glyph_instances->vao = vao;
+	glyph_instances->vbo = vbo;
+	glyph_instances->num_instances = (GLsizei)instances.size();
+
+	return (Rml::CompiledGeometryHandle)glyph_instances;
+}
+
+void RenderInterface_GL3::RenderGlyphInstances(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, Rml::TextureHandle texture,
+	Rml::ColourbPremultiplied colour)
+{
+	Gfx::CompiledGlyphInstancesData* glyph_instances = (Gfx::CompiledGlyphInstancesData*)handle;
+
+	UseProgram(ProgramId::Glyph);
+	SubmitTransformUniform(translation);
+
+	const Rml::Colourf colour_f = ConvertToColorf(colour);
+	glUniform4fv(GetUniformLocation(UniformId::Color), 1, &colour_f[0]);
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture);
+
+	glBindVertexArray(glyph_instances->vao);
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, glyph_instances->num_instances);
+
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	Gfx::CheckGLError("RenderGlyphInstances");
+}
+
+void RenderInterface_GL3::ReleaseGlyphInstances(Rml::CompiledGeometryHandle handle)
+{
+	Gfx::CompiledGlyphInstancesData* glyph_instances = (Gfx::CompiledGlyphInstancesData*)handle;
+
+	glDeleteVertexArrays(1, &glyph_instances->vao);
+	glDeleteBuffers(1, &glyph_instances->vbo);
+
+	delete glyph_instances;
+}
+
 void RenderInterface_GL3::BlitLayerToPostprocessPrimary(Rml::LayerHandle layer_handle)
 {
 	const Gfx::FramebufferData& source = render_layers.GetLayer(layer_handle);
@@ -95,6 +95,12 @@ public:
 		Rml::TextureHandle texture) override;
 	void ReleaseShader(Rml::CompiledShaderHandle effect_handle) override;
 
+	bool IsGlyphInstancingSupported() override;
+	Rml::CompiledGeometryHandle CompileGlyphInstances(Rml::Span<const Rml::GlyphInstance> instances) override;
+	void RenderGlyphInstances(Rml::CompiledGeometryHandle handle, Rml::Vector2f translation, Rml::TextureHandle texture,
+		Rml::ColourbPremultiplied colour) override;
+	void ReleaseGlyphInstances(Rml::CompiledGeometryHandle handle) override;
+
 	// Can be passed to RenderGeometry() to enable texture rendering without changing the bound texture.
 	static constexpr Rml::TextureHandle TextureEnableWithoutBinding = Rml::TextureHandle(-1);
 	// Can be passed to RenderGeometry() to leave the bound texture and used program unchanged.
@@ -16,6 +16,9 @@ if(RMLUI_FONT_ENGINE STREQUAL "freetype")
 	endif()
 
 	report_dependency_found_or_error("Freetype" Freetype::Freetype "Freetype font engine enabled")
+
+	find_package("Threads")
+	report_dependency_found_or_error("Threads" Threads::Threads)
 endif()
 
 if(RMLUI_LOTTIE_PLUGIN)
@@ -58,6 +58,10 @@ public:
 
 	operator Texture() const;
 
+	/// Releases the texture generated by the callback, if any, so that the callback is called again the next time the texture is used.
+	/// @note Any geometry referring to this callback texture remains valid, and will be rendered with the newly generated texture.
+	void Invalidate();
+
 	void Release();
 
 private:
@@ -108,6 +112,9 @@ public:
 
 	Texture GetTexture(RenderManager& render_manager) const;
 
+	/// Invalidates the texture generated for each render manager, so that the callback is called again the next time the texture is used.
+	void Invalidate();
+
 private:
 	CallbackTextureFunction callback;
 	mutable SmallUnorderedMap<RenderManager*, CallbackTexture> textures;
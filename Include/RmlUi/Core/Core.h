@@ -147,6 +147,26 @@ RMLUICORE_API bool LoadFontFace(const String& file_path, bool fallback_face = fa
 /// @lifetime The pointed to 'data' must remain available until after the call to Rml::Shutdown.
 RMLUICORE_API bool LoadFontFace(Span<const byte> data, const String& family, Style::FontStyle style,
 	Style::FontWeight weight = Style::FontWeight::Auto, bool fallback_face = false);
+/// Enables or disables distance-field glyph resampling for font faces loaded after this call. In this mode, the outline of each glyph is only
+/// rasterized once per font face, and the glyph bitmaps of every font size are resampled on the CPU from its signed distance field. This reduces the
+/// cost of generating glyphs for new font sizes, such as when animating the font size. Glyphs without a scalable outline, such as color emojis, are
+/// always rasterized directly.
+/// @param[in] enable True to resample glyphs from distance fields, false to rasterize the glyphs of every font size directly.
+/// @note Only supported by the default font engine.
+/// @note Glyph bitmaps are still generated and stored for each font size, and rendered like any other glyphs.
+RMLUICORE_API void SetFontDistanceFieldResampling(bool enable);
+/// Enables or disables lazy loading of font faces, applies to font faces loaded after this call. In this mode, font files are memory-mapped
+/// through the file interface where supported, and each face is only loaded once it is first used. This reduces the startup time and memory use
+/// of large font files, such as fallback fonts for other scripts, which may never be used.
+/// @param[in] enable True to load font faces lazily, false to load them right away.
+/// @note Only supported by the default font engine.
+RMLUICORE_API void SetFontLazyLoading(bool enable);
+/// Sets the number of worker threads used to generate glyph textures, such as when applying font effects to the glyphs of a new font size.
+/// The work is split between the worker threads and the calling thread, which waits for all of it to complete. By default, no worker threads
+/// are used and all glyphs are generated in order on the calling thread.
+/// @param[in] num_threads The number of worker threads, or zero to generate all glyphs on the calling thread.
+/// @note Only supported by the default font engine. Any custom font effects must be safe to call from multiple threads when using worker threads.
+RMLUICORE_API void SetFontWorkerThreads(int num_threads);
 
 /// Registers a generic RmlUi plugin.
 RMLUICORE_API void RegisterPlugin(Plugin* plugin);
@@ -46,8 +46,18 @@ public:
 
 	bool IsVariableDirty(const String& variable_name);
 	void DirtyVariable(const String& variable_name);
+	// Dirty only a part of a variable, such as a single member of one entry in an array: DirtyVariable(DataAddress{"items", 5, "name"}).
+	// Only views depending on this address, on a part of it, or on a variable containing it are updated. Views depending on other parts of the
+	// variable are not updated, even if their values are derived from the changed part, such as through getter functions.
+	void DirtyVariable(const DataAddress& address);
 	void DirtyAllVariables();
 
+	// Dirty changed variables automatically, instead of calling the functions above. During each update, the current value at every address which
+	// data views depend on is compared against the value from the previous update, and the addresses of changed values are dirtied as above.
+	// Arrays are compared by their size only, their entries are compared through the addresses of the views depending on them. Each value is
+	// read during every update, including calls to any getter functions, which may be costly for large models. Disabled by default.
+	void EnableAutoDirty(bool enable);
+
 	explicit operator bool() { return model; }
 
 private:
@@ -65,6 +65,7 @@ using DirtyVariables = SmallUnorderedSet<String>;
 
 struct DataAddressEntry {
 	DataAddressEntry(String name) : name(std::move(name)), index(-1) {}
+	DataAddressEntry(const char* name) : name(name), index(-1) {}
 	DataAddressEntry(int index) : index(index) {}
 	String name;
 	int index;
@@ -46,6 +46,7 @@ namespace Rml {
 
 class Context;
 class DataModel;
+class DataViewFor;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
@@ -55,6 +56,8 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class LayoutCache;
+class ClipRegionCache;
 class LayoutEngine;
 class ContainerBox;
 class InlineLevelBox;
@@ -65,6 +68,8 @@ class RenderManager;
 class StyleSheet;
 class StyleSheetContainer;
 class TransformState;
+class WidgetScroll;
+enum class InvalidationFlags : uint8_t;
 struct ElementMeta;
 struct StackingContextChild;
 
@@ -589,6 +594,10 @@ public:
 	Element* GetClosestScrollableContainer();
 	/// Returns the element's transform state.
 	const TransformState* GetTransformState() const noexcept;
+	/// Returns the element's cache of intermediate layout results.
+	LayoutCache* GetLayoutCache() const;
+	/// Returns the element's retained clipping region.
+	ClipRegionCache* GetClipRegionCache() const;
 	/// Returns the data model of this element.
 	DataModel* GetDataModel() const;
 	//@}
@@ -615,7 +624,7 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
-	/// Called during the update loop after children are updated.
+	/// Called during the update loop before children are updated, only when the element needs to be updated, see DirtyUpdate().
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -664,6 +673,13 @@ protected:
 	enum class DirtyNodes { Self, SelfAndSiblings };
 	// Dirty the element style definition, including all descendants of the specified nodes.
 	void DirtyDefinition(DirtyNodes dirty_nodes);
+	// Dirty the style definition of only those elements affected by a change to our names, as determined by the style sheet's invalidation sets.
+	void DirtyDefinition(InvalidationFlags invalidation_flags);
+
+	/// Marks the element as needing to be updated during the next update loop, and its ancestors as having such a descendant.
+	/// @note Elements are only updated when they have pending changes, such as dirty properties or running animations. Elements that need
+	/// OnUpdate() to be called during every update loop should call this function from OnUpdate().
+	void DirtyUpdate();
 
 	void SetOwnerDocument(ElementDocument* document);
 
@@ -676,6 +692,13 @@ private:
 
 	void SetDataModel(DataModel* new_data_model);
 
+	/// Moves the given children into the given order, at the positions currently occupied by them. The children stay attached to this element, so
+	/// that their state and data bindings are retained.
+	void ReorderChildren(const ElementList& ordered_children);
+
+	/// Dirties the layout of the nearest layout boundary at or above the given element, or the whole document if there is none.
+	void DirtyLayoutFrom(Element* element);
+
 	void DirtyAbsoluteOffset();
 	void DirtyAbsoluteOffsetRecursive();
 	void UpdateOffset();
@@ -729,8 +752,11 @@ private:
 	bool offset_fixed;
 	bool absolute_offset_dirty;
 
-	bool dirty_definition : 1; // Implies dirty child definitions as well.
-	bool dirty_child_definitions : 1;
+	bool dirty_definition : 1;        // The element's own definition needs to be updated.
+	bool dirty_child_definitions : 1; // The definitions of all descendants need to be updated.
+
+	bool dirty_update : 1;       // The element itself needs to be updated.
+	bool dirty_child_update : 1; // At least one descendant needs to be updated.
 
 	bool dirty_animation : 1;
 	bool dirty_transition : 1;
@@ -798,12 +824,14 @@ private:
 	ElementMeta* meta;
 
 	friend class Rml::Context;
+	friend class Rml::DataViewFor;
 	friend class Rml::ElementStyle;
 	friend class Rml::ContainerBox;
 	friend class Rml::InlineLevelBox;
 	friend class Rml::ReplacedBox;
 	friend class Rml::LayoutEngine;
 	friend class Rml::ElementScroll;
+	friend class Rml::WidgetScroll;
 	friend RMLUICORE_API void Rml::ReleaseFontResources();
 };
 
@@ -163,8 +163,10 @@ private:
 
 	/// Sets the dirty flag on the layout so the document will format its children before the next render.
 	void DirtyLayout() override;
-	/// Returns true if the document has been marked as needing a re-layout.
+	/// Returns true if the whole document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Marks a layout boundary so that only its contents will be formatted before the next render, unless the whole document is dirty.
+	void DirtyLayoutBoundary(Element* layout_boundary);
 
 	/// Notify the document that media query related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -193,7 +195,11 @@ private:
 	bool layout_dirty;
 	bool position_dirty;
 
+	// Layout boundaries whose contents need to be formatted, when the document itself is not dirty.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
+
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 };
 
@@ -35,6 +35,9 @@
 
 namespace Rml {
 
+struct TextGeometry;
+struct TextShapingContext;
+
 /**
     @author Peter Curry
  */
@@ -97,8 +100,14 @@ private:
 		int width;
 	};
 
-	// Clears and regenerates all of the text's geometry.
+	// Regenerates all of the text's geometry, or finds matching geometry generated by another text element.
 	void GenerateGeometry(RenderManager& render_manager, FontFaceHandle font_face_handle);
+	// Generates meshes for the text, optionally reusing the buffers of the previous geometry.
+	void GenerateMeshes(RenderManager& render_manager, FontFaceHandle font_face_handle, const TextShapingContext& text_shaping_context,
+		TextGeometry& text_geometry, TextGeometry* previous_geometry);
+	// Generates glyph instances for the text instead of meshes, returns false if the font engine does not support glyph instances.
+	bool GenerateGlyphInstances(RenderManager& render_manager, FontFaceHandle font_face_handle, const TextShapingContext& text_shaping_context,
+		TextGeometry& text_geometry, TextGeometry* previous_geometry);
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(Mesh& mesh, FontFaceHandle font_face_handle);
 
@@ -107,11 +116,8 @@ private:
 	using LineList = Vector<Line>;
 	LineList lines;
 
-	struct TexturedGeometry {
-		Geometry geometry;
-		Texture texture;
-	};
-	Vector<TexturedGeometry> geometry;
+	// The geometry generated for the lines, possibly shared with other text elements.
+	SharedPtr<TextGeometry> text_geometry;
 
 	// The decoration geometry we've generated for this string.
 	UniquePtr<Geometry> decoration;
@@ -87,6 +87,16 @@ public:
 	/// @param out_data The string contents of the file.
 	/// @return True on success.
 	virtual bool LoadFile(const String& path, String& out_data);
+
+	/// Maps the contents of a file into memory for reading, instead of reading it into a buffer. Used for large files, such as fonts, that
+	/// may only be partially accessed. The default implementation does not support memory mapping, and always returns an empty span.
+	/// @param file The handle of the file to map.
+	/// @return The mapped contents of the file, or an empty span if the file could not be mapped, in which case it is read instead.
+	/// @note The mapped memory must remain valid after the file is closed, until it is released through UnmapFile().
+	virtual Span<const byte> MapFile(FileHandle file);
+	/// Releases memory previously mapped through MapFile().
+	/// @param data The mapped contents of the file.
+	virtual void UnmapFile(Span<const byte> data);
 };
 
 } // namespace Rml
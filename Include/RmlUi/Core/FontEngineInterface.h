@@ -116,6 +116,20 @@ public:
 	virtual int GenerateString(RenderManager& render_manager, FontFaceHandle face_handle, FontEffectsHandle font_effects_handle, StringView string,
 		Vector2f position, ColourbPremultiplied colour, float opacity, const TextShapingContext& text_shaping_context, TexturedMeshList& mesh_list);
 
+	/// Called by RmlUi when it wants to retrieve the glyph instances required to render a single line of text, when supported by the render
+	/// interface. The colour and opacity of the text are applied while rendering each instance list, as specified by its tint, so that the
+	/// instances remain valid when they change.
+	/// @param[in] render_manager The render manager responsible for rendering the string.
+	/// @param[in] face_handle The font handle.
+	/// @param[in] font_effects_handle The handle to the prepared font effects for which the instances should be generated.
+	/// @param[in] string The string to render.
+	/// @param[in] position The position of the baseline of the first character to render.
+	/// @param[in] text_shaping_context Additional parameters that provide context for text shaping.
+	/// @param[out] instance_list A list to place the glyph instances and textures representing the string to be rendered.
+	/// @return The width, in pixels, of the string, or -1 if glyph instances are not supported, in which case GenerateString() is used instead.
+	virtual int GenerateStringInstances(RenderManager& render_manager, FontFaceHandle face_handle, FontEffectsHandle font_effects_handle,
+		StringView string, Vector2f position, const TextShapingContext& text_shaping_context, TexturedGlyphInstancesList& instance_list);
+
 	/// Called by RmlUi to determine if the text geometry is required to be re-generated. Whenever the returned version
 	/// is changed, all geometry belonging to the given face handle will be re-generated.
 	/// @param[in] face_handle The font handle.
@@ -59,5 +59,26 @@ private:
 	friend class RenderManager;
 };
 
+/**
+    A list of glyph instances to be rendered through its underlying render interface using instancing.
+
+    A unique resource constructed through the render manager.
+ */
+class RMLUICORE_API GlyphInstanceGeometry final
+	: public UniqueRenderResource<GlyphInstanceGeometry, StableVectorIndex, StableVectorIndex::Invalid> {
+public:
+	GlyphInstanceGeometry() = default;
+
+	/// Renders the glyph instances, multiplying the given colour with the colour of every instance.
+	void Render(Vector2f translation, Texture texture, ColourbPremultiplied colour) const;
+
+	/// Releases the instances, returning the instance data for reuse.
+	Vector<GlyphInstance> Release();
+
+private:
+	GlyphInstanceGeometry(RenderManager* render_manager, StableVectorIndex resource_handle);
+	friend class RenderManager;
+};
+
 } // namespace Rml
 #endif
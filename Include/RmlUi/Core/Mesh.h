@@ -49,5 +49,20 @@ struct TexturedMesh {
 
 using TexturedMeshList = Vector<TexturedMesh>;
 
+/// Specifies which part of the text colour is applied when rendering a list of glyph instances.
+enum class GlyphTint : uint8_t {
+	Colour,  // The colour of the text, used for regular glyphs.
+	Alpha,   // The alpha of the text colour only, used for glyphs with their own colours.
+	Opacity, // The opacity of the text only, used for font effects.
+};
+
+struct TexturedGlyphInstances {
+	Vector<GlyphInstance> instances;
+	Texture texture;
+	GlyphTint tint = GlyphTint::Colour;
+};
+
+using TexturedGlyphInstancesList = Vector<TexturedGlyphInstances>;
+
 } // namespace Rml
 #endif
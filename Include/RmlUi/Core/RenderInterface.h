@@ -169,6 +169,31 @@ public:
 	/// Called by RmlUi when it no longer needs a previously compiled shader.
 	/// @param[in] shader The handle to a previously compiled shader.
 	virtual void ReleaseShader(CompiledShaderHandle shader);
+
+	/**
+	    @name Optional functions for rendering text using instancing.
+	 */
+
+	/// Called by RmlUi to determine whether the glyph instancing functions below are implemented.
+	/// @return True if glyph instancing is supported, otherwise text is rendered using regular geometry.
+	/// @note Only called once for each render manager, before any glyph instances are compiled.
+	virtual bool IsGlyphInstancingSupported();
+	/// Called by RmlUi when it wants to compile a list of glyph instances to be rendered later.
+	/// @param[in] instances The glyph instances, each to be rendered as a textured quad.
+	/// @return An application-specified handle to the instances, or zero if they could not be compiled.
+	/// @lifetime The pointed-to instance data is guaranteed to be valid and immutable until ReleaseGlyphInstances()
+	/// is called with the handle returned here.
+	virtual CompiledGeometryHandle CompileGlyphInstances(Span<const GlyphInstance> instances);
+	/// Called by RmlUi when it wants to render a list of glyph instances.
+	/// @param[in] instances The handle to previously compiled glyph instances.
+	/// @param[in] translation The translation to apply to the instances.
+	/// @param[in] texture The texture to sample the glyphs from.
+	/// @param[in] colour The colour to multiply with the colour of every instance.
+	/// @note Each instance should be rendered like geometry with four vertices, sharing the product of the two colours.
+	virtual void RenderGlyphInstances(CompiledGeometryHandle instances, Vector2f translation, TextureHandle texture, ColourbPremultiplied colour);
+	/// Called by RmlUi when it no longer needs previously compiled glyph instances.
+	/// @param[in] instances The handle to previously compiled glyph instances.
+	virtual void ReleaseGlyphInstances(CompiledGeometryHandle instances);
 };
 
 } // namespace Rml
@@ -38,6 +38,7 @@
 namespace Rml {
 
 class Geometry;
+class GlyphInstanceGeometry;
 class CompiledFilter;
 class CompiledShader;
 class TextureDatabase;
@@ -90,6 +91,11 @@ public:
 
 	void SetTransform(const Matrix4f* new_transform);
 
+	// Enables merging of consecutive geometry render calls sharing the same texture and render state. Merged geometry is
+	// compiled into a new vertex and index buffer every frame, trading CPU time for fewer render calls.
+	void EnableGeometryBatching(bool enable);
+	bool IsGeometryBatchingEnabled() const;
+
 	// Retrieves the cached render state. If setting this state again, ensure the lifetimes of referenced objects are
 	// still valid. Possibly invalidating actions include destroying an element, or altering its transform property.
 	const RenderState& GetState() const { return state; }
@@ -98,6 +104,10 @@ public:
 
 	Geometry MakeGeometry(Mesh&& mesh);
 
+	// Returns true if the render interface supports rendering glyph instances. The render interface is queried on first use.
+	bool IsGlyphInstancingSupported();
+	GlyphInstanceGeometry MakeGlyphInstanceGeometry(Vector<GlyphInstance>&& instances);
+
 	Texture LoadTexture(const String& source, const String& document_path = String());
 	CallbackTexture MakeCallbackTexture(CallbackTextureFunction callback);
 
@@ -120,15 +130,23 @@ private:
 	CompiledGeometryHandle GetCompiledGeometryHandle(StableVectorIndex index);
 
 	void Render(const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
+	void Render(const GlyphInstanceGeometry& geometry, Vector2f translation, Texture texture, ColourbPremultiplied colour);
+
+	TextureHandle GetTextureHandle(Texture texture);
+
+	void FlushGeometryBatch();
+	void ReleaseGeometryBatches();
 
 	void GetTextureSourceList(StringList& source_list) const;
 
 	bool ReleaseTexture(const String& texture_source);
 	void ReleaseAllTextures();
+	void ReleaseInvalidatedTextures();
 	void ReleaseAllCompiledGeometry();
 
 	void ReleaseResource(const CallbackTexture& texture);
 	Mesh ReleaseResource(const Geometry& geometry);
+	Vector<GlyphInstance> ReleaseResource(const GlyphInstanceGeometry& geometry);
 	void ReleaseResource(const CompiledFilter& filter);
 	void ReleaseResource(const CompiledShader& shader);
 
@@ -139,8 +157,31 @@ private:
 
 	RenderInterface* render_interface = nullptr;
 
+	struct BatchedGeometry {
+		StableVectorIndex geometry;
+		Vector2f translation;
+	};
+
 	StableVector<GeometryData> geometry_list;
+
+	struct GlyphInstanceData {
+		Vector<GlyphInstance> instances;
+		CompiledGeometryHandle handle = {};
+	};
+
+	StableVector<GlyphInstanceData> glyph_instance_list;
+	bool glyph_instancing_detected = false;
+	bool glyph_instancing_supported = false;
+
+	// Pending geometry to be rendered with the same texture, and the merged geometry submitted during the current frame.
+	bool geometry_batching = false;
+	TextureHandle batch_texture = {};
+	Vector<BatchedGeometry> batch_list;
+	Vector<GeometryData> batch_geometry_list;
+	size_t num_batch_geometry = 0;
 	UniquePtr<TextureDatabase> texture_database;
+	// Generated callback textures which have since been invalidated, released at the start of the next frame.
+	Vector<TextureHandle> invalidated_textures;
 
 	int compiled_filter_count = 0;
 	int compiled_shader_count = 0;
@@ -34,11 +34,16 @@
 #include "StyleSheetTypes.h"
 #include "Traits.h"
 
+#if defined(RMLUI_DEBUG) || defined(RMLUI_TRACY_PROFILING)
+	#define RMLUI_STYLESHEET_MATCHING_STATISTICS
+#endif
+
 namespace Rml {
 
 class Element;
 class ElementDefinition;
 class StyleSheetNode;
+class StyleSheetInvalidationSets;
 class Decorator;
 class RenderManager;
 class SpritesheetList;
@@ -58,6 +63,15 @@ using DecoratorPtrList = Vector<SharedPtr<const Decorator>>;
 
 class RMLUICORE_API StyleSheet final : public NonCopyMoveable {
 public:
+	/// Counters for the element definition lookups of a style sheet, useful for profiling the selectivity of its rules.
+	/// @note Only collected in debug builds or when profiling is enabled, otherwise all counters remain zero.
+	struct MatchingStatistics {
+		size_t num_lookups = 0;         // Number of elements (excluding text elements) looked up.
+		size_t num_candidate_nodes = 0; // Number of nodes found in the index by any of the element's names.
+		size_t num_tested_nodes = 0;    // Number of candidate nodes not ruled out by the name filters, and thereby matched against the element.
+		size_t num_matched_nodes = 0;   // Number of nodes applicable to the element.
+	};
+
 	~StyleSheet();
 
 	/// Combines this style sheet with another one, producing a new sheet.
@@ -82,7 +96,18 @@ public:
 	const Sprite* GetSprite(const String& name) const;
 
 	/// Returns the compiled element definition for a given element and its hierarchy.
-	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element) const;
+	/// @param[in] element The element to find the definition of.
+	/// @param[out] out_shareable_with_siblings If set, this is set to true when the definition only depends on the element's tag, id, classes,
+	/// pseudo classes, and ancestors. Then the definition can be shared with any of its siblings that have the same names and pseudo classes.
+	SharedPtr<const ElementDefinition> GetElementDefinition(const Element* element, bool* out_shareable_with_siblings = nullptr) const;
+
+	/// Returns the invalidation sets, which determine the elements affected by changes to the names of an element.
+	const StyleSheetInvalidationSets& GetInvalidationSets() const;
+
+	/// Returns the accumulated statistics of all element definition lookups since the last reset.
+	const MatchingStatistics& GetMatchingStatistics() const;
+	/// Resets the element definition lookup statistics.
+	void ResetMatchingStatistics();
 
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
 	const DecoratorPtrList& InstanceDecorators(RenderManager& render_manager, const DecoratorDeclarationList& declaration_list,
@@ -113,6 +138,9 @@ private:
 	// Map of all styled nodes, that is, they have one or more properties.
 	StyleSheetIndex styled_node_index;
 
+	// Map of the names used in selectors to the elements affected by changes to them.
+	UniquePtr<StyleSheetInvalidationSets> invalidation_sets;
+
 	// Index of node sets to element definitions.
 	using ElementDefinitionCache = UnorderedMap<StyleSheetIndex::NodeList, SharedPtr<const ElementDefinition>>;
 	mutable ElementDefinitionCache node_cache;
@@ -121,6 +149,8 @@ private:
 	using DecoratorCache = UnorderedMap<String, Vector<SharedPtr<const Decorator>>>;
 	mutable DecoratorCache decorator_cache;
 
+	mutable MatchingStatistics matching_statistics;
+
 	friend Rml::StyleSheetParser;
 	friend Rml::StyleSheetContainer;
 };
@@ -49,5 +49,20 @@ struct RMLUICORE_API Vertex {
 	Vector2f tex_coord;
 };
 
+/**
+    A single glyph to be rendered as a textured quad using instancing.
+ */
+
+struct RMLUICORE_API GlyphInstance {
+	/// Two-dimensional position of the top-left corner of the quad (usually in pixels).
+	Vector2f position;
+	/// Width and height of the quad.
+	Vector2f size;
+	/// Texture coordinates of the top-left and bottom-right corners of the quad.
+	Vector2f tex_coords[2];
+	/// RGBA-ordered 8-bit/channel colour with premultiplied alpha, to be multiplied with the colour the instances are rendered with.
+	ColourbPremultiplied colour;
+};
+
 } // namespace Rml
 #endif
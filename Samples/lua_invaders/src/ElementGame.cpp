@@ -80,6 +80,9 @@ void ElementGame::ProcessEvent(Rml::Event& event)
 
 void ElementGame::OnUpdate()
 {
+	// Keep updating to advance the game.
+	DirtyUpdate();
+
 	game->Update(Rml::GetSystemInterface()->GetElapsedTime());
 
 	if (game->IsGameOver())
@@ -0,0 +1,118 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    A bloom filter of the tags, ids, and class names of an element's ancestors.
+
+    Used to quickly reject style sheet nodes with descendant or child combinators, without walking the element's ancestors.
+    Also used for an element's own names, to rule out nodes requiring additional names than the one they were indexed by.
+    The filter may report false positives, but never false negatives. Thus, a node whose required names are not all
+    contained in the filter can never match, while any other node must still be matched normally.
+*/
+class AncestorFilter {
+public:
+	enum class NameType : uint8_t { Tag, Id, Class };
+
+	/// Adds a name to the filter.
+	void Add(NameType type, const String& name)
+	{
+		const uint64_t hash = uint64_t(Hash<String>()(name)) ^ (uint64_t(type) + 1) * 0x9E3779B97F4A7C15ull;
+		// Set two bits per name, using separate parts of the hash.
+		SetBit(hash);
+		SetBit((hash >> 16) ^ (hash >> 32));
+	}
+
+	/// Adds the tag, id, and class names of an element to the filter.
+	void AddElement(const String& tag, const String& id, const StringList& class_names)
+	{
+		Add(NameType::Tag, tag);
+		if (!id.empty())
+			Add(NameType::Id, id);
+		for (const String& name : class_names)
+			Add(NameType::Class, name);
+	}
+
+	/// Adds all the names in the other filter to this filter.
+	void Merge(const AncestorFilter& other)
+	{
+		for (int i = 0; i < NumWords; i++)
+			words[i] |= other.words[i];
+	}
+
+	/// Returns true if all the names in the other filter may be contained in this filter.
+	bool MayContain(const AncestorFilter& other) const
+	{
+		for (int i = 0; i < NumWords; i++)
+		{
+			if ((words[i] & other.words[i]) != other.words[i])
+				return false;
+		}
+		return true;
+	}
+
+	bool operator==(const AncestorFilter& other) const
+	{
+		for (int i = 0; i < NumWords; i++)
+		{
+			if (words[i] != other.words[i])
+				return false;
+		}
+		return true;
+	}
+
+	bool IsEmpty() const
+	{
+		for (int i = 0; i < NumWords; i++)
+		{
+			if (words[i])
+				return false;
+		}
+		return true;
+	}
+
+private:
+	static constexpr int NumBits = 512;
+	static constexpr int NumWords = NumBits / 64;
+
+	void SetBit(uint64_t hash)
+	{
+		const int bit = int(hash % NumBits);
+		words[bit / 64] |= (uint64_t(1) << (bit % 64));
+	}
+
+	uint64_t words[NumWords] = {};
+};
+
+} // namespace Rml
+#endif
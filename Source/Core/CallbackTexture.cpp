@@ -32,6 +32,12 @@
 
 namespace Rml {
 
+void CallbackTexture::Invalidate()
+{
+	if (resource_handle != StableVectorIndex::Invalid)
+		RenderManagerAccess::InvalidateTexture(render_manager, resource_handle);
+}
+
 void CallbackTexture::Release()
 {
 	if (resource_handle != StableVectorIndex::Invalid)
@@ -109,4 +115,10 @@ Texture CallbackTextureSource::GetTexture(RenderManager& render_manager) const
 	return Texture(texture);
 }
 
+void CallbackTextureSource::Invalidate()
+{
+	for (auto& texture : textures)
+		texture.second.Invalidate();
+}
+
 } // namespace Rml
@@ -0,0 +1,81 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_CLIPREGIONCACHE_H
+#define RMLUI_CORE_CLIPREGIONCACHE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    Retains the clipping region of an element between render calls.
+
+    Finding the clipping region of an element requires walking all its offset ancestors, which is done for every element
+    every frame. For mostly static documents the result rarely changes, so we store it on the element. Only regions
+    consisting of a plain scissor rectangle are stored, clip mask geometry is always looked up again.
+
+    Instead of tracking which elements depend on each ancestor, all stored regions are invalidated together by bumping a
+    global generation whenever any input to the clipping region may have changed. That is, an element's offset, box,
+    scrollable overflow, transform, or its clipping properties.
+*/
+class ClipRegionCache {
+public:
+	/// Invalidates the stored regions of all elements.
+	static void DirtyAll() { generation += 1; }
+
+	/// Retrieves the stored clipping region.
+	/// @param[out] out_scissoring_enabled True if the element should be clipped by the scissor region.
+	/// @param[out] out_clip_region The scissor region, valid when scissoring is enabled.
+	/// @return True if a valid region was stored, false if it must be recomputed.
+	bool Get(bool& out_scissoring_enabled, Rectanglei& out_clip_region) const
+	{
+		if (stored_generation != generation)
+			return false;
+		out_scissoring_enabled = scissoring_enabled;
+		out_clip_region = clip_region;
+		return true;
+	}
+
+	/// Stores the clipping region until the next invalidation.
+	void Set(bool in_scissoring_enabled, Rectanglei in_clip_region)
+	{
+		stored_generation = generation;
+		scissoring_enabled = in_scissoring_enabled;
+		clip_region = in_clip_region;
+	}
+
+private:
+	static uint64_t generation;
+
+	uint64_t stored_generation = 0;
+	bool scissoring_enabled = false;
+	Rectanglei clip_region;
+};
+
+} // namespace Rml
+#endif
@@ -48,6 +48,10 @@
 #include <iterator>
 #include <limits>
 
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	#include "FontEngineDefault/FontProvider.h"
+#endif
+
 namespace Rml {
 
 static constexpr float DOUBLE_CLICK_TIME = 0.5f;    // [s]
@@ -218,6 +222,10 @@ bool Context::Render()
 
 	render_manager->PrepareRender(dimensions);
 
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	FontProvider::BeginFrame();
+#endif
+
 	root->Render();
 
 	// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
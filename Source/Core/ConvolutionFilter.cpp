@@ -31,6 +31,14 @@
 #include <float.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define RMLUI_CONVOLUTION_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#include <arm_neon.h>
+	#define RMLUI_CONVOLUTION_NEON
+#endif
+
 namespace Rml {
 
 ConvolutionFilter::ConvolutionFilter() {}
@@ -67,12 +75,138 @@ float* ConvolutionFilter::operator[](int kernel_y_index)
 	return kernel.get() + kernel_size.x * kernel_y_index;
 }
 
+namespace {
+	// Operations on four float lanes. Multiplications and additions are kept separate, so that each lane rounds exactly like a scalar expression.
+#if defined(RMLUI_CONVOLUTION_SSE2)
+	using FloatLanes = __m128;
+	inline FloatLanes LanesSplat(float value)
+	{
+		return _mm_set1_ps(value);
+	}
+	inline FloatLanes LanesLoad(const float* values)
+	{
+		return _mm_loadu_ps(values);
+	}
+	inline void LanesStore(float* values, FloatLanes lanes)
+	{
+		_mm_storeu_ps(values, lanes);
+	}
+	inline FloatLanes LanesAdd(FloatLanes a, FloatLanes b)
+	{
+		return _mm_add_ps(a, b);
+	}
+	inline FloatLanes LanesMul(FloatLanes a, FloatLanes b)
+	{
+		return _mm_mul_ps(a, b);
+	}
+	inline FloatLanes LanesMax(FloatLanes a, FloatLanes b)
+	{
+		return _mm_max_ps(a, b);
+	}
+#elif defined(RMLUI_CONVOLUTION_NEON)
+	using FloatLanes = float32x4_t;
+	inline FloatLanes LanesSplat(float value)
+	{
+		return vdupq_n_f32(value);
+	}
+	inline FloatLanes LanesLoad(const float* values)
+	{
+		return vld1q_f32(values);
+	}
+	inline void LanesStore(float* values, FloatLanes lanes)
+	{
+		vst1q_f32(values, lanes);
+	}
+	inline FloatLanes LanesAdd(FloatLanes a, FloatLanes b)
+	{
+		return vaddq_f32(a, b);
+	}
+	inline FloatLanes LanesMul(FloatLanes a, FloatLanes b)
+	{
+		return vmulq_f32(a, b);
+	}
+	inline FloatLanes LanesMax(FloatLanes a, FloatLanes b)
+	{
+		return vbslq_f32(vcgtq_f32(a, b), a, b);
+	}
+#else
+	struct FloatLanes {
+		float values[4];
+	};
+	inline FloatLanes LanesSplat(float value)
+	{
+		return FloatLanes{{value, value, value, value}};
+	}
+	inline FloatLanes LanesLoad(const float* values)
+	{
+		return FloatLanes{{values[0], values[1], values[2], values[3]}};
+	}
+	inline void LanesStore(float* values, FloatLanes lanes)
+	{
+		for (int i = 0; i < 4; i++)
+			values[i] = lanes.values[i];
+	}
+	inline FloatLanes LanesAdd(FloatLanes a, FloatLanes b)
+	{
+		for (int i = 0; i < 4; i++)
+			a.values[i] += b.values[i];
+		return a;
+	}
+	inline FloatLanes LanesMul(FloatLanes a, FloatLanes b)
+	{
+		for (int i = 0; i < 4; i++)
+			a.values[i] *= b.values[i];
+		return a;
+	}
+	inline FloatLanes LanesMax(FloatLanes a, FloatLanes b)
+	{
+		for (int i = 0; i < 4; i++)
+			a.values[i] = Math::Max(a.values[i], b.values[i]);
+		return a;
+	}
+#endif
+
+	// Accumulates a row of weighted values into the row of results, the count must be a multiple of four.
+	template <FilterOperation operation>
+	void AccumulateRow(float* results, const float* values, const float weight, const int count)
+	{
+		const FloatLanes weight_lanes = LanesSplat(weight);
+		for (int x = 0; x < count; x += 4)
+		{
+			const FloatLanes weighted_values = LanesMul(LanesLoad(values + x), weight_lanes);
+			const FloatLanes accumulated = LanesLoad(results + x);
+			if (operation == FilterOperation::Sum)
+				LanesStore(results + x, LanesAdd(accumulated, weighted_values));
+			else
+				LanesStore(results + x, LanesMax(accumulated, weighted_values));
+		}
+	}
+
+	// Sets each result to the maximum of the 'length' values starting at the same position, in linear time using the van Herk/Gil-Werman
+	// algorithm. The maximum is exact, thus the order of operations does not matter.
+	void SlidingMaximum(float* results, const float* values, const int count, const int length, Vector<float>& prefix, Vector<float>& suffix)
+	{
+		prefix.resize(count);
+		suffix.resize(count);
+
+		for (int i = 0; i < count; i++)
+			prefix[i] = (i % length == 0 ? values[i] : Math::Max(prefix[i - 1], values[i]));
+		for (int i = count - 1; i >= 0; i--)
+			suffix[i] = (i % length == length - 1 || i == count - 1 ? values[i] : Math::Max(suffix[i + 1], values[i]));
+		for (int i = 0; i + length <= count; i++)
+			results[i] = Math::Max(suffix[i], prefix[i + length - 1]);
+	}
+} // namespace
+
 void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
 	const ColorFormat destination_color_format, const byte* source, const Vector2i source_dimensions, const Vector2i source_offset,
 	const ColorFormat source_color_format) const
 {
 	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
 
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
 	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
 	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
@@ -80,39 +214,122 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
-	for (int y = 0; y < destination_dimensions.y; ++y)
+	// Copy the source opacity into a float buffer padded with zeros, covering every source pixel sampled by the kernel. This way, the filter is
+	// applied without any bounds checks. Samples outside the source contribute zero, which never changes the sum or the maximum.
+	const Vector2i padded_dimensions = destination_dimensions + kernel_size - Vector2i(1);
+	const Vector2i padded_origin = -source_offset - kernel_radius;
+	const int padded_stride = padded_dimensions.x + 4;
+
+	Vector<float> padded_source(size_t(padded_stride) * size_t(padded_dimensions.y), 0.f);
+	for (int y = 0; y < padded_dimensions.y; ++y)
 	{
-		for (int x = 0; x < destination_dimensions.x; ++x)
+		const int source_y = padded_origin.y + y;
+		if (source_y < 0 || source_y >= source_dimensions.y)
+			continue;
+
+		float* padded_row = padded_source.data() + y * padded_stride;
+		const int x_begin = Math::Max(0, -padded_origin.x);
+		const int x_end = Math::Min(padded_dimensions.x, source_dimensions.x - padded_origin.x);
+		for (int x = x_begin; x < x_end; ++x)
 		{
-			float opacity = 0.f;
+			const int source_index = (source_y * source_dimensions.x + padded_origin.x + x) * source_bytes_per_pixel + source_alpha_offset;
+			padded_row[x] = float(source[source_index]);
+		}
+	}
+
+	// The results are accumulated one kernel value at a time, for four destination pixels at a time.
+	const int results_stride = (destination_dimensions.x + 3) & ~3;
+	Vector<float> results(size_t(results_stride) * size_t(destination_dimensions.y), 0.f);
 
-			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+	switch (operation)
+	{
+	case FilterOperation::Sum:
+	{
+		// Add the kernel values in the same order for every pixel, so that the rounding is the same as when adding them pixel by pixel.
+		for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+		{
+			for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
 			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+				const float weight = kernel[kernel_y * kernel_size.x + kernel_x];
+				if (weight == 0.f)
+					continue;
+
+				for (int y = 0; y < destination_dimensions.y; ++y)
+				{
+					const float* padded_row = padded_source.data() + (y + kernel_y) * padded_stride + kernel_x;
+					AccumulateRow<FilterOperation::Sum>(results.data() + y * results_stride, padded_row, weight, results_stride);
+				}
+			}
+		}
+	}
+	break;
+	case FilterOperation::Dilation:
+	{
+		// The maximum of values multiplied by the same positive weight equals the maximum of the values multiplied by the weight. Thus, we split
+		// each kernel row into spans of equal weights, such as the interior of circular kernels, and apply the sliding maximum of the source for
+		// each span length. Non-positive weights never exceed the initial zero result, and can be skipped.
+		struct KernelSpan {
+			int kernel_y;
+			int kernel_x;
+			float weight;
+		};
+		Vector<Vector<KernelSpan>> spans_by_length(kernel_size.x + 1);
 
-				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+		for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+		{
+			const float* kernel_row = kernel.get() + kernel_y * kernel_size.x;
+			for (int kernel_x = 0; kernel_x < kernel_size.x;)
+			{
+				const float weight = kernel_row[kernel_x];
+				int span_end = kernel_x + 1;
+				if (weight > 0.f)
 				{
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-
-						switch (operation)
-						{
-						case FilterOperation::Sum: opacity += pixel_opacity; break;
-						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-						}
-					}
+					while (span_end < kernel_size.x && kernel_row[span_end] == weight)
+						span_end++;
+					spans_by_length[span_end - kernel_x].push_back(KernelSpan{kernel_y, kernel_x, weight});
 				}
+				kernel_x = span_end;
 			}
+		}
 
-			opacity = Math::Min(255.f, opacity);
+		Vector<float> sliding_maximum, prefix, suffix;
+		for (int length = 1; length <= kernel_size.x; length++)
+		{
+			if (spans_by_length[length].empty())
+				continue;
+
+			const float* values = padded_source.data();
+			if (length > 1)
+			{
+				sliding_maximum.assign(padded_source.size(), 0.f);
+				for (int y = 0; y < padded_dimensions.y; ++y)
+				{
+					SlidingMaximum(sliding_maximum.data() + y * padded_stride, padded_source.data() + y * padded_stride, padded_dimensions.x, length,
+						prefix, suffix);
+				}
+				values = sliding_maximum.data();
+			}
 
-			const int destination_index = y * destination_stride + x * destination_bytes_per_pixel + destination_alpha_offset;
-			destination[destination_index] = byte(opacity);
+			for (const KernelSpan& span : spans_by_length[length])
+			{
+				for (int y = 0; y < destination_dimensions.y; ++y)
+				{
+					const float* values_row = values + (y + span.kernel_y) * padded_stride + span.kernel_x;
+					AccumulateRow<FilterOperation::Dilation>(results.data() + y * results_stride, values_row, span.weight, results_stride);
+				}
+			}
 		}
 	}
+	break;
+	}
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		const float* results_row = results.data() + y * results_stride;
+		byte* destination_row = destination + y * destination_stride + destination_alpha_offset;
+		for (int x = 0; x < destination_dimensions.x; ++x)
+			destination_row[x * destination_bytes_per_pixel] = byte(Math::Min(255.f, results_row[x]));
+	}
 }
 
 } // namespace Rml
@@ -50,6 +50,7 @@
 
 #ifdef RMLUI_FONT_ENGINE_FREETYPE
 	#include "FontEngineDefault/FontEngineInterfaceDefault.h"
+	#include "FontEngineDefault/FontProvider.h"
 #endif
 
 #ifdef RMLUI_LOTTIE_PLUGIN
@@ -357,6 +358,33 @@ bool LoadFontFace(Span<const byte> data, const String& family, Style::FontStyle
 	return font_interface->LoadFontFace(data, family, style, weight, fallback_face);
 }
 
+void SetFontDistanceFieldResampling(bool enable)
+{
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	FontProvider::SetDistanceFieldResampling(enable);
+#else
+	(void)enable;
+#endif
+}
+
+void SetFontLazyLoading(bool enable)
+{
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	FontProvider::SetLazyLoading(enable);
+#else
+	(void)enable;
+#endif
+}
+
+void SetFontWorkerThreads(int num_threads)
+{
+#ifdef RMLUI_FONT_ENGINE_FREETYPE
+	FontProvider::SetNumWorkerThreads(num_threads);
+#else
+	(void)num_threads;
+#endif
+}
+
 void RegisterPlugin(Plugin* plugin)
 {
 	if (initialised)
@@ -437,6 +465,13 @@ void ReleaseFontResources()
 
 		font_interface->ReleaseFontResources();
 
+		// Font textures are released by invalidating them, make sure the memory is freed now instead of on the next frame.
+		if (render_managers)
+		{
+			for (auto& render_manager : *render_managers)
+				RenderManagerAccess::ReleaseInvalidatedTextures(render_manager.second.get());
+		}
+
 		for (const auto& name_context : contexts)
 			name_context.second->Update();
 	}
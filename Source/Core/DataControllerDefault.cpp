@@ -82,7 +82,7 @@ void DataControllerValue::ProcessEvent(Event& event)
 
 		if (DataVariable variable = model->GetVariable(address))
 			if (variable.Set(value_to_set))
-				model->DirtyVariable(address.front().name);
+				model->DirtyRootVariable(address);
 	}
 }
 
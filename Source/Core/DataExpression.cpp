@@ -29,6 +29,7 @@
 #include "DataExpression.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
 #include "../../Include/RmlUi/Core/Event.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataModel.h"
 #include <stack>
@@ -113,6 +114,8 @@ namespace Parse {
 	static void Expression(DataParser& parser);
 } // namespace Parse
 
+static int FoldConstants(Program& program);
+
 class DataParser {
 public:
 	DataParser(String expression, DataExpressionInterface expression_interface) :
@@ -178,6 +181,9 @@ public:
 	{
 		program.clear();
 		variable_addresses.clear();
+		variable_names.clear();
+		all_addresses_found = true;
+		max_stack_size = 0;
 		index = 0;
 		reached_end = false;
 		parse_error = false;
@@ -202,6 +208,9 @@ public:
 			Error(CreateString("Internal parser error, inconsistent stack operations. Stack size is %d at parse end.", program_stack_size));
 		}
 
+		if (!parse_error)
+			max_stack_size = FoldConstants(program);
+
 		return !parse_error;
 	}
 
@@ -215,6 +224,16 @@ public:
 		RMLUI_ASSERT(!parse_error);
 		return std::move(variable_addresses);
 	}
+	StringList ReleaseVariableNames()
+	{
+		RMLUI_ASSERT(!parse_error);
+		return std::move(variable_names);
+	}
+
+	// The program can only be reused by other expressions if all of its variable addresses were found.
+	bool AllAddressesFound() const { return all_addresses_found; }
+	// The maximum number of values on the stack during execution of the program.
+	int GetStackSize() const { return max_stack_size; }
 
 	void Emit(Instruction instruction, Variant data = Variant())
 	{
@@ -271,10 +290,12 @@ public:
 		DataAddress address = expression_interface.ParseAddress(name);
 		if (address.empty())
 		{
+			all_addresses_found = false;
 			return false;
 		}
 
 		variable_addresses.push_back(std::move(address));
+		variable_names.push_back(name);
 		return true;
 	}
 
@@ -289,6 +310,7 @@ private:
 		}
 		int index = int(variable_addresses.size());
 		variable_addresses.push_back(std::move(address));
+		variable_names.push_back(name);
 		program.push_back(InstructionData{is_assignment ? Instruction::Assign : Instruction::Variable, Variant(int(index))});
 	}
 
@@ -299,10 +321,13 @@ private:
 	bool reached_end = false;
 	bool parse_error = true;
 	int program_stack_size = 0;
+	int max_stack_size = 0;
 
 	Program program;
 
 	AddressList variable_addresses;
+	StringList variable_names;
+	bool all_addresses_found = true;
 };
 
 namespace Parse {
@@ -914,9 +939,36 @@ static String DumpProgram(const Program& program)
 
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface) :
-		program(program), addresses(addresses), expression_interface(expression_interface)
-	{}
+	DataInterpreter(const Program& program, int stack_size, const AddressList& addresses, DataExpressionInterface expression_interface,
+		const DataVariable* root_variables = nullptr) :
+		stack(inline_stack),
+		stack_size(stack_size), program(program), addresses(addresses), root_variables(root_variables), expression_interface(expression_interface)
+	{
+		if (stack_size > inline_stack_size)
+		{
+			heap_stack.resize(size_t(stack_size));
+			stack = heap_stack.data();
+		}
+	}
+	~DataInterpreter()
+	{
+		while (stack_top > 0)
+			StackValue(--stack_top).~Variant();
+	}
+
+	// Evaluates an operator with the given register values, used for folding constant sub-expressions.
+	static Variant EvaluateOperator(Instruction instruction, const Variant& left, const Variant& right)
+	{
+		const Program program;
+		const AddressList addresses;
+		DataInterpreter interpreter(program, 0, addresses, DataExpressionInterface());
+		interpreter.L = left;
+		interpreter.R = right;
+		const bool success = interpreter.Execute(instruction, Variant());
+		RMLUI_ASSERT(success);
+		(void)success;
+		return std::move(interpreter.R);
+	}
 
 	bool Error(const String& message) const
 	{
@@ -937,9 +989,9 @@ public:
 			}
 		}
 
-		if (success && !stack.empty())
-			Log::Message(Log::LT_WARNING, "Possible data interpreter stack corruption. Stack size is %zu at end of execution (should be zero).",
-				stack.size());
+		if (success && stack_top != 0)
+			Log::Message(Log::LT_WARNING, "Possible data interpreter stack corruption. Stack size is %d at end of execution (should be zero).",
+				stack_top);
 
 		if (!success)
 		{
@@ -951,14 +1003,27 @@ public:
 		return success;
 	}
 
-	Variant Result() const { return R; }
+	Variant& Result() { return R; }
 
 private:
 	Variant R, L, C;
-	Vector<Variant> stack;
+
+	// The stack size is determined by the parser, most programs fit in the inline stack so that no memory needs to be allocated. Values are
+	// constructed in the stack slots when pushed and destroyed when popped, thus unused slots don't need to be constructed at all.
+	using StackSlot = std::aligned_storage_t<sizeof(Variant), alignof(Variant)>;
+	static constexpr int inline_stack_size = 4;
+	StackSlot inline_stack[inline_stack_size];
+	Vector<StackSlot> heap_stack;
+	StackSlot* stack;
+	int stack_size = 0;
+	int stack_top = 0;
+
+	Variant& StackValue(int index) { return *reinterpret_cast<Variant*>(&stack[index]); }
 
 	const Program& program;
 	const AddressList& addresses;
+	// Optional, the top-level variable of each address, or an invalid variable if it is not bound to the data model.
+	const DataVariable* root_variables;
 	DataExpressionInterface expression_interface;
 
 	bool Execute(const Instruction instruction, const Variant& data)
@@ -969,25 +1034,31 @@ private:
 		{
 		case Instruction::Push:
 		{
-			stack.push_back(std::move(R));
+			if (stack_top >= stack_size)
+				return Error(CreateString("Cannot push to stack, it is full with %d elements.", stack_size));
+
+			new (&stack[stack_top++]) Variant(std::move(R));
 			R.Clear();
 		}
 		break;
 		case Instruction::Pop:
 		{
-			if (stack.empty())
+			if (stack_top <= 0)
 				return Error("Cannot pop stack, it is empty.");
 
 			Register reg = Register(data.Get<int>(-1));
+			Variant& value = StackValue(stack_top - 1);
 			switch (reg)
 			{
 				// clang-format off
-			case Register::R:  R = stack.back(); stack.pop_back(); break;
-			case Register::L:  L = stack.back(); stack.pop_back(); break;
-			case Register::C:  C = stack.back(); stack.pop_back(); break;
+			case Register::R:  R = std::move(value); break;
+			case Register::L:  L = std::move(value); break;
+			case Register::C:  C = std::move(value); break;
 				// clang-format on
 			default: return Error(CreateString("Invalid register %d.", int(reg)));
 			}
+			value.~Variant();
+			stack_top -= 1;
 		}
 		break;
 		case Instruction::Literal:
@@ -1007,10 +1078,13 @@ private:
 		case Instruction::Variable:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
-			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
-			else
+			if (variable_index >= addresses.size())
 				return Error("Variable address not found.");
+
+			if (root_variables && root_variables[variable_index])
+				expression_interface.GetValue(addresses[variable_index], root_variables[variable_index], R);
+			else
+				R = expression_interface.GetValue(addresses[variable_index]);
 		}
 		break;
 		case Instruction::Add:
@@ -1018,41 +1092,45 @@ private:
 			if (AnyString(L, R))
 				R = Variant(L.Get<String>() + R.Get<String>());
 			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+				R = GetNumber(L) + GetNumber(R);
 		}
 		break;
 			// clang-format off
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		case Instruction::Subtract:  R = GetNumber(L) - GetNumber(R);  break;
+		case Instruction::Multiply:  R = GetNumber(L) * GetNumber(R);  break;
+		case Instruction::Divide:    R = GetNumber(L) / GetNumber(R);  break;
+		case Instruction::Not:       R = !R.Get<bool>();                 break;
+		case Instruction::And:       R = (L.Get<bool>() && R.Get<bool>()); break;
+		case Instruction::Or:        R = (L.Get<bool>() || R.Get<bool>()); break;
+		case Instruction::Less:      R = (GetNumber(L) < GetNumber(R));  break;
+		case Instruction::LessEq:    R = (GetNumber(L) <= GetNumber(R)); break;
+		case Instruction::Greater:   R = (GetNumber(L) > GetNumber(R));  break;
+		case Instruction::GreaterEq: R = (GetNumber(L) >= GetNumber(R)); break;
 			// clang-format on
 		case Instruction::Equal:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
+			if (L.GetType() == Variant::STRING && R.GetType() == Variant::STRING)
+				R = (L.GetReference<String>() == R.GetReference<String>());
+			else if (AnyString(L, R))
+				R = (L.Get<String>() == R.Get<String>());
 			else
-				R = Variant(L.Get<double>() == R.Get<double>());
+				R = (GetNumber(L) == GetNumber(R));
 		}
 		break;
 		case Instruction::NotEqual:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
+			if (L.GetType() == Variant::STRING && R.GetType() == Variant::STRING)
+				R = (L.GetReference<String>() != R.GetReference<String>());
+			else if (AnyString(L, R))
+				R = (L.Get<String>() != R.Get<String>());
 			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+				R = (GetNumber(L) != GetNumber(R));
 		}
 		break;
 		case Instruction::Ternary:
 		{
 			if (L.Get<bool>())
-				R = C;
+				R = std::move(C);
 		}
 		break;
 		case Instruction::NumArguments:
@@ -1064,11 +1142,13 @@ private:
 		case Instruction::TransformFnc:
 		case Instruction::EventFnc:
 		{
-			Vector<Variant> arguments;
+			DataExpressionCache* cache = expression_interface.GetExpressionCache();
+			VariantList arguments = (cache ? cache->AcquireArgumentBuffer() : VariantList());
+
 			if (!ExtractArgumentsFromStack(arguments))
 				return false;
 
-			const String function_name = data.Get<String>();
+			const String& function_name = data.GetReference<String>();
 			const bool result = (instruction == Instruction::TransformFnc ? expression_interface.CallTransform(function_name, arguments, R)
 																		  : expression_interface.EventCallback(function_name, arguments));
 			if (!result)
@@ -1084,6 +1164,9 @@ private:
 					CreateString("Failed to execute %s: %s(%s)", instruction == Instruction::TransformFnc ? "transform function" : "event callback",
 						function_name.c_str(), arguments_str.c_str()));
 			}
+
+			if (cache)
+				cache->ReleaseArgumentBuffer(std::move(arguments));
 		}
 		break;
 		case Instruction::Assign:
@@ -1117,54 +1200,277 @@ private:
 		int num_arguments = R.Get<int>(-1);
 		if (num_arguments < 0)
 			return Error("Invalid number of arguments.");
-		if (stack.size() < size_t(num_arguments))
-			return Error(CreateString("Cannot pop %d arguments, stack contains only %zu elements.", num_arguments, stack.size()));
+		if (stack_top < num_arguments)
+			return Error(CreateString("Cannot pop %d arguments, stack contains only %d elements.", num_arguments, stack_top));
 
-		const auto it_stack_begin_arguments = stack.end() - num_arguments;
-		out_arguments.insert(out_arguments.end(), std::make_move_iterator(it_stack_begin_arguments), std::make_move_iterator(stack.end()));
+		for (int i = stack_top - num_arguments; i < stack_top; i++)
+		{
+			out_arguments.push_back(std::move(StackValue(i)));
+			StackValue(i).~Variant();
+		}
 
-		stack.erase(it_stack_begin_arguments, stack.end());
+		stack_top -= num_arguments;
 		return true;
 	}
+
+	// Returns the value as a number, with a fast path for the most common numeric types.
+	static double GetNumber(const Variant& value)
+	{
+		const Variant::Type type = value.GetType();
+		if (type == Variant::DOUBLE)
+			return value.GetReference<double>();
+		if (type == Variant::FLOAT)
+			return double(value.GetReference<float>());
+		if (type == Variant::INT)
+			return double(value.GetReference<int>());
+		return value.Get<double>();
+	}
 };
 
+/*
+    Folds the constant sub-expressions of a program into literals.
+
+    Operators with only literal operands are evaluated once here instead of during every execution, and ternary operators with a literal
+    condition are reduced to the selected branch. The instructions are moved one by one to the end of the folded part of the program, which is
+    folded whenever its tail matches one of the patterns below. Thereby, nested constant sub-expressions are folded too, such as in
+    '!(1 + 2 > 2)'. Returns the maximum number of values on the stack during execution of the folded program.
+*/
+static int FoldConstants(Program& program)
+{
+	size_t n = 0;
+
+	auto IsLiteral = [&program](size_t index) { return program[index].instruction == Instruction::Literal; };
+	auto IsPop = [&program](size_t index, Register reg) {
+		return program[index].instruction == Instruction::Pop && program[index].data.Get<int>(-1) == int(reg);
+	};
+	auto ReplaceTail = [&program, &n](size_t first_replaced, Variant&& literal) {
+		program[first_replaced] = InstructionData{Instruction::Literal, std::move(literal)};
+		n = first_replaced + 1;
+	};
+
+	// Returns the index of the push instruction matching the given pop instruction.
+	auto FindMatchingPush = [&program](size_t pop_index) {
+		int depth = 0;
+		for (size_t i = pop_index + 1; i-- > 0;)
+		{
+			const Instruction instruction = program[i].instruction;
+			if (instruction == Instruction::Pop)
+				depth += 1;
+			else if (instruction == Instruction::TransformFnc || instruction == Instruction::EventFnc)
+				depth += program[i - 1].data.Get<int>(0);
+			else if (instruction == Instruction::Push && --depth == 0)
+				return i;
+		}
+		RMLUI_ERRORMSG("Unmatched pop instruction.");
+		return size_t(0);
+	};
+
+	for (size_t i = 0; i < program.size(); i++)
+	{
+		if (i != n)
+			program[n] = std::move(program[i]);
+		n += 1;
+
+		const Instruction instruction = program[n - 1].instruction;
+		switch (instruction)
+		{
+		case Instruction::Not:
+		{
+			// [Literal] [Not]
+			if (n >= 2 && IsLiteral(n - 2))
+				ReplaceTail(n - 2, DataInterpreter::EvaluateOperator(instruction, Variant(), program[n - 2].data));
+		}
+		break;
+		case Instruction::CastToInt:
+		{
+			// [Literal] [CastToInt]
+			int value = 0;
+			if (n >= 2 && IsLiteral(n - 2) && program[n - 2].data.GetInto(value))
+				ReplaceTail(n - 2, Variant(value));
+		}
+		break;
+		case Instruction::Add:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
+		case Instruction::Equal:
+		case Instruction::NotEqual:
+		{
+			// [Literal] [Push] [Literal] [Pop L] [Operator]
+			if (n >= 5 && IsLiteral(n - 5) && program[n - 4].instruction == Instruction::Push && IsLiteral(n - 3) && IsPop(n - 2, Register::L))
+				ReplaceTail(n - 5, DataInterpreter::EvaluateOperator(instruction, program[n - 5].data, program[n - 3].data));
+		}
+		break;
+		case Instruction::Ternary:
+		{
+			// [Literal] [Push] [Branch A...] [Push] [Branch B...] [Pop C] [Pop L] [Ternary]
+			if (n < 5 || !IsPop(n - 2, Register::L) || !IsPop(n - 3, Register::C))
+				break;
+
+			const size_t push_condition = FindMatchingPush(n - 2);
+			if (push_condition == 0 || !IsLiteral(push_condition - 1))
+				break;
+
+			const size_t push_branch_a = FindMatchingPush(n - 3);
+			const size_t first_replaced = push_condition - 1;
+			const bool condition = program[first_replaced].data.Get<bool>();
+
+			const size_t branch_begin = (condition ? push_condition + 1 : push_branch_a + 1);
+			const size_t branch_end = (condition ? push_branch_a : n - 3);
+
+			std::move(program.begin() + branch_begin, program.begin() + branch_end, program.begin() + first_replaced);
+			n = first_replaced + (branch_end - branch_begin);
+		}
+		break;
+		case Instruction::Push:
+		case Instruction::Pop:
+		case Instruction::Literal:
+		case Instruction::Variable:
+		case Instruction::NumArguments:
+		case Instruction::TransformFnc:
+		case Instruction::EventFnc:
+		case Instruction::Assign:
+		case Instruction::DynamicVariable: break;
+		}
+	}
+
+	program.erase(program.begin() + n, program.end());
+
+	int stack_size = 0;
+	int max_stack_size = 0;
+	for (size_t i = 0; i < program.size(); i++)
+	{
+		const Instruction instruction = program[i].instruction;
+		if (instruction == Instruction::Push)
+			max_stack_size = Math::Max(max_stack_size, ++stack_size);
+		else if (instruction == Instruction::Pop)
+			stack_size -= 1;
+		else if (instruction == Instruction::TransformFnc || instruction == Instruction::EventFnc)
+			stack_size -= program[i - 1].data.Get<int>(0);
+	}
+	RMLUI_ASSERT(stack_size == 0);
+
+	return max_stack_size;
+}
+
 DataExpression::DataExpression(String expression) : expression(std::move(expression)) {}
 
 DataExpression::~DataExpression() {}
 
 bool DataExpression::Parse(const DataExpressionInterface& expression_interface, bool is_assignment_expression)
 {
+	DataExpressionCache* cache = expression_interface.GetExpressionCache();
+
+	// Reuse the program of an identical expression if available, then we only need to resolve its variables for the current element.
+	if (cache)
+	{
+		if (ParsedExpressionPtr cached_expression = cache->Find(expression, is_assignment_expression))
+		{
+			AddressList cached_addresses;
+			cached_addresses.reserve(cached_expression->variable_names.size());
+
+			for (const String& name : cached_expression->variable_names)
+			{
+				DataAddress address = expression_interface.ParseAddress(name);
+				if (address.empty())
+					break;
+				cached_addresses.push_back(std::move(address));
+			}
+
+			// Otherwise, parse it again below to get identical behavior and error reporting as the uncached expression.
+			if (cached_addresses.size() == cached_expression->variable_names.size())
+			{
+				parsed_expression = std::move(cached_expression);
+				addresses = std::move(cached_addresses);
+				ResolveRootVariables(expression_interface);
+				return true;
+			}
+		}
+	}
+
 	DataParser parser(expression, expression_interface);
 	if (!parser.Parse(is_assignment_expression))
 		return false;
 
-	program = parser.ReleaseProgram();
+	const bool all_addresses_found = parser.AllAddressesFound();
+
+	auto new_expression = MakeShared<ParsedExpression>();
+	new_expression->program = parser.ReleaseProgram();
+	new_expression->variable_names = parser.ReleaseVariableNames();
+	new_expression->stack_size = parser.GetStackSize();
 	addresses = parser.ReleaseAddresses();
+	parsed_expression = new_expression;
+	ResolveRootVariables(expression_interface);
+
+	if (cache && all_addresses_found)
+		cache->Insert(expression, is_assignment_expression, std::move(new_expression));
 
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	if (!parsed_expression)
+		return false;
+
+	DataInterpreter interpreter(parsed_expression->program, parsed_expression->stack_size, addresses, expression_interface, root_variables.data());
 
 	if (!interpreter.Run())
 		return false;
 
-	out_value = interpreter.Result();
+	out_value = std::move(interpreter.Result());
 	return true;
 }
 
-StringList DataExpression::GetVariableNameList() const
+const AddressList& DataExpression::GetVariableAddressList() const
 {
-	StringList list;
-	list.reserve(addresses.size());
+	return addresses;
+}
+
+void DataExpression::ResolveRootVariables(const DataExpressionInterface& expression_interface)
+{
+	root_variables.clear();
+	root_variables.reserve(addresses.size());
 	for (const DataAddress& address : addresses)
-	{
-		if (!address.empty())
-			list.push_back(address[0].name);
-	}
-	return list;
+		root_variables.push_back(expression_interface.GetRootVariable(address));
+}
+
+DataExpressionCache::DataExpressionCache() {}
+
+DataExpressionCache::~DataExpressionCache() {}
+
+ParsedExpressionPtr DataExpressionCache::Find(const String& expression, bool is_assignment_expression) const
+{
+	const auto& map = (is_assignment_expression ? assignment_expressions : expressions);
+	auto it = map.find(expression);
+	if (it == map.end())
+		return nullptr;
+	return it->second;
+}
+
+void DataExpressionCache::Insert(const String& expression, bool is_assignment_expression, ParsedExpressionPtr parsed_expression)
+{
+	auto& map = (is_assignment_expression ? assignment_expressions : expressions);
+	map[expression] = std::move(parsed_expression);
+}
+
+VariantList DataExpressionCache::AcquireArgumentBuffer()
+{
+	VariantList arguments = std::move(argument_buffer);
+	arguments.clear();
+	return arguments;
+}
+
+void DataExpressionCache::ReleaseArgumentBuffer(VariantList&& arguments)
+{
+	arguments.clear();
+	argument_buffer = std::move(arguments);
 }
 
 DataExpressionInterface::DataExpressionInterface(DataModel* data_model, Element* element, Event* event) :
@@ -1178,6 +1484,16 @@ DataAddress DataExpressionInterface::ParseAddress(const String& address_str) con
 
 	return data_model ? data_model->ResolveAddress(address_str, element) : DataAddress();
 }
+
+DataExpressionCache* DataExpressionInterface::GetExpressionCache() const
+{
+	return data_model ? &data_model->GetExpressionCache() : nullptr;
+}
+DataVariable DataExpressionInterface::GetRootVariable(const DataAddress& address) const
+{
+	return data_model ? data_model->GetRootVariable(address) : DataVariable();
+}
+
 Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 {
 	Variant result;
@@ -1195,6 +1511,23 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
+bool DataExpressionInterface::GetValue(const DataAddress& address, DataVariable root_variable, Variant& out_value) const
+{
+	if (event && address.size() == 2 && address.front().name == "ev")
+	{
+		out_value = GetValue(address);
+		return true;
+	}
+
+	if (!data_model)
+	{
+		out_value.Clear();
+		return false;
+	}
+
+	return data_model->GetVariableInto(root_variable, address, out_value);
+}
+
 bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
@@ -1204,7 +1537,7 @@ bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant
 			result = variable.Set(value);
 
 		if (result)
-			data_model->DirtyVariable(address.front().name);
+			data_model->DirtyRootVariable(address);
 	}
 	return result;
 }
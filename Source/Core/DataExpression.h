@@ -30,6 +30,7 @@
 #define RMLUI_CORE_DATAEXPRESSION_H
 
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
@@ -41,13 +42,45 @@ struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
 
+// The parsed program of an expression, along with the names of the variables it refers to in the order of its address list. The program
+// does not depend on the element it is evaluated on, thus it can be shared by all expressions with the same source, such as in 'data-for' rows.
+struct ParsedExpression {
+	Program program;
+	StringList variable_names;
+	// The maximum number of values on the stack during execution of the program.
+	int stack_size = 0;
+};
+using ParsedExpressionPtr = SharedPtr<const ParsedExpression>;
+
+class DataExpressionCache : NonCopyMoveable {
+public:
+	DataExpressionCache();
+	~DataExpressionCache();
+
+	ParsedExpressionPtr Find(const String& expression, bool is_assignment_expression) const;
+	void Insert(const String& expression, bool is_assignment_expression, ParsedExpressionPtr parsed_expression);
+
+	// Argument lists are reused between function calls to avoid allocations. Acquire moves the buffer out, in case the call executes other
+	// expressions, and release returns it for the next call.
+	VariantList AcquireArgumentBuffer();
+	void ReleaseArgumentBuffer(VariantList&& arguments);
+
+private:
+	UnorderedMap<String, ParsedExpressionPtr> expressions;
+	UnorderedMap<String, ParsedExpressionPtr> assignment_expressions;
+	VariantList argument_buffer;
+};
+
 class DataExpressionInterface {
 public:
 	DataExpressionInterface() = default;
 	DataExpressionInterface(DataModel* data_model, Element* element, Event* event = nullptr);
 
 	DataAddress ParseAddress(const String& address_str) const;
+	DataExpressionCache* GetExpressionCache() const;
+	DataVariable GetRootVariable(const DataAddress& address) const;
 	Variant GetValue(const DataAddress& address) const;
+	bool GetValue(const DataAddress& address, DataVariable root_variable, Variant& out_value) const;
 	bool SetValue(const DataAddress& address, const Variant& value) const;
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result);
 	bool EventCallback(const String& name, const VariantList& arguments);
@@ -68,13 +101,18 @@ public:
 	bool Run(const DataExpressionInterface& expression_interface, Variant& out_value);
 
 	// Available after Parse()
-	StringList GetVariableNameList() const;
+	const AddressList& GetVariableAddressList() const;
 
 private:
+	void ResolveRootVariables(const DataExpressionInterface& expression_interface);
+
 	String expression;
 
-	Program program;
+	ParsedExpressionPtr parsed_expression;
 	AddressList addresses;
+
+	// The top-level variables of the addresses, resolved during parsing so that they don't need to be looked up by name on every execution.
+	Vector<DataVariable> root_variables;
 };
 
 } // namespace Rml
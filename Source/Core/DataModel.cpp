@@ -30,7 +30,9 @@
 #include "../../Include/RmlUi/Core/DataTypeRegister.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "DataController.h"
+#include "DataExpression.h"
 #include "DataView.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -124,6 +126,7 @@ DataModel::DataModel(DataTypeRegister* data_type_register) : data_type_register(
 {
 	views = MakeUnique<DataViews>();
 	controllers = MakeUnique<DataControllers>();
+	expression_cache = MakeUnique<DataExpressionCache>();
 }
 
 DataModel::~DataModel()
@@ -231,6 +234,16 @@ bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddr
 
 bool DataModel::EraseAliases(Element* element)
 {
+	auto it_slot = row_slot_owners.find(element);
+	if (it_slot != row_slot_owners.end())
+	{
+		RowSlot& slot = row_slots[it_slot->second];
+		slot.container_address.clear();
+		slot.owner = nullptr;
+		free_row_slots.push_back(it_slot->second);
+		row_slot_owners.erase(it_slot);
+	}
+
 	return aliases.erase(element) == 1;
 }
 
@@ -303,17 +316,23 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 
 	auto it = variables.find(address.front().name);
 	if (it != variables.end())
+		return GetChildVariable(it->second, address, 1);
+
+	if (address[0].name == "#row")
 	{
-		DataVariable variable = it->second;
+		const int slot_index = (address.size() > 1 ? address[1].index : -1);
+		if (slot_index < 0 || slot_index >= (int)row_slots.size() || !row_slots[slot_index].owner)
+			return DataVariable();
 
-		for (int i = 1; i < (int)address.size() && variable; i++)
-		{
-			variable = variable.Child(address[i]);
-			if (!variable)
-				return DataVariable();
-		}
+		const RowSlot& slot = row_slots[slot_index];
+		if (address.size() == 3 && address[2].name == "#index")
+			return MakeLiteralIntVariable(slot.index);
 
-		return variable;
+		DataVariable container = GetVariable(slot.container_address);
+		if (!container)
+			return DataVariable();
+
+		return GetChildVariable(container.Child(DataAddressEntry(slot.index)), address, 2);
 	}
 
 	if (address[0].name == "literal")
@@ -325,6 +344,26 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	return DataVariable();
 }
 
+DataVariable DataModel::GetRootVariable(const DataAddress& address) const
+{
+	if (address.empty())
+		return DataVariable();
+
+	auto it = variables.find(address.front().name);
+	if (it != variables.end())
+		return it->second;
+
+	return DataVariable();
+}
+
+DataVariable DataModel::GetChildVariable(DataVariable variable, const DataAddress& address, size_t first_entry) const
+{
+	for (size_t i = first_entry; i < address.size() && variable; i++)
+		variable = variable.Child(address[i]);
+
+	return variable;
+}
+
 const DataEventFunc* DataModel::GetEventCallback(const String& name)
 {
 	auto it = event_callbacks.find(name);
@@ -346,6 +385,65 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 	return result;
 }
 
+bool DataModel::GetVariableInto(DataVariable root_variable, const DataAddress& address, Variant& out_value) const
+{
+	RMLUI_ASSERT(root_variable && !address.empty());
+	DataVariable variable = GetChildVariable(root_variable, address, 1);
+	bool result = (variable && variable.Get(out_value));
+	if (!result)
+	{
+		Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", DataAddressToString(address).c_str());
+		out_value.Clear();
+	}
+	return result;
+}
+
+DataVariable DataModel::GetEntryVariable(DataVariable parent, const DataAddress& address, size_t entry_index) const
+{
+	RMLUI_ASSERT(entry_index < address.size());
+	const DataAddressEntry& entry = address[entry_index];
+
+	if (entry_index == 0)
+	{
+		auto it = variables.find(entry.name);
+		return it != variables.end() ? it->second : DataVariable();
+	}
+
+	if (entry_index <= 2 && address[0].name == "#row")
+	{
+		const int slot_index = address[1].index;
+		if (slot_index < 0 || slot_index >= (int)row_slots.size() || !row_slots[slot_index].owner)
+			return DataVariable();
+
+		const RowSlot& slot = row_slots[slot_index];
+		if (entry_index == 2 && entry.name == "#index")
+			return MakeLiteralIntVariable(slot.index);
+
+		if (entry_index == 1)
+		{
+			DataVariable container = GetVariable(slot.container_address);
+			if (!container || container.Type() != DataVariableType::Array || slot.index >= container.Size())
+				return DataVariable();
+			return container.Child(DataAddressEntry(slot.index));
+		}
+	}
+
+	if (!parent)
+		return DataVariable();
+
+	switch (parent.Type())
+	{
+	case DataVariableType::Scalar: return DataVariable();
+	case DataVariableType::Array:
+		if (entry.index >= parent.Size())
+			return DataVariable();
+		break;
+	case DataVariableType::Struct: break;
+	}
+
+	return parent.Child(entry);
+}
+
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
@@ -353,10 +451,65 @@ void DataModel::DirtyVariable(const String& variable_name)
 	dirty_variables.emplace(variable_name);
 }
 
+void DataModel::DirtyVariable(const DataAddress& address)
+{
+	RMLUI_ASSERTMSG(!address.empty() && (variables.count(address.front().name) == 1 || address.front().name == "#row"),
+		"In DirtyVariable: Variable name not found among added variables.");
+
+	if (address.size() == 1)
+		dirty_variables.emplace(address.front().name);
+	else if (!address.empty())
+		dirty_addresses.push_back(address);
+}
+
+void DataModel::DirtyRootVariable(const DataAddress& address)
+{
+	if (address.empty())
+		return;
+
+	if (address.front().name == "#row")
+	{
+		const int slot_index = (address.size() > 1 ? address[1].index : -1);
+		if (slot_index >= 0 && slot_index < (int)row_slots.size() && row_slots[slot_index].owner)
+			DirtyRootVariable(row_slots[slot_index].container_address);
+		return;
+	}
+
+	DirtyVariable(address.front().name);
+}
+
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	if (dirty_variables.count(variable_name) == 1)
+		return true;
+
+	// The variable is also dirty when only a part of it has been dirtied.
+	return std::any_of(dirty_addresses.begin(), dirty_addresses.end(),
+		[&variable_name](const DataAddress& address) { return address.front().name == variable_name; });
+}
+
+bool DataModel::IsAddressDirty(const DataAddress& address) const
+{
+	if (address.empty())
+		return false;
+
+	if (dirty_variables.count(address.front().name) == 1)
+		return true;
+
+	const bool dirty_address_contains_address = std::any_of(dirty_addresses.begin(), dirty_addresses.end(), [&address](const DataAddress& dirty) {
+		return dirty.size() <= address.size() &&
+			std::equal(dirty.begin(), dirty.end(), address.begin(),
+				[](const DataAddressEntry& a, const DataAddressEntry& b) { return a.index == b.index && a.name == b.name; });
+	});
+	if (dirty_address_contains_address)
+		return true;
+
+	// Row slots are also dirty when their current entry in the container is dirty.
+	if (address.front().name == "#row")
+		return IsAddressDirty(GetRowSlotEntryAddress(address));
+
+	return false;
 }
 
 void DataModel::DirtyAllVariables()
@@ -368,6 +521,11 @@ void DataModel::DirtyAllVariables()
 	}
 }
 
+void DataModel::EnableAutoDirty(bool enable)
+{
+	views->SetChangeDetection(enable);
+}
+
 bool DataModel::CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const
 {
 	if (const auto transform_register = data_type_register->GetTransformFuncRegister())
@@ -375,6 +533,68 @@ bool DataModel::CallTransform(const String& name, const VariantList& arguments,
 	return false;
 }
 
+int DataModel::CreateRowSlot(Element* owner, const DataAddress& container_address, int index)
+{
+	RMLUI_ASSERT(owner && row_slot_owners.count(owner) == 0);
+
+	int slot_index = (int)row_slots.size();
+	if (free_row_slots.empty())
+	{
+		row_slots.emplace_back();
+	}
+	else
+	{
+		slot_index = free_row_slots.back();
+		free_row_slots.pop_back();
+	}
+
+	RowSlot& slot = row_slots[slot_index];
+	slot.container_address = container_address;
+	slot.index = index;
+	slot.owner = owner;
+	row_slot_owners[owner] = slot_index;
+
+	return slot_index;
+}
+
+void DataModel::SetRowSlotIndex(int slot_index, int index)
+{
+	RMLUI_ASSERT(slot_index >= 0 && slot_index < (int)row_slots.size() && row_slots[slot_index].owner);
+
+	row_slots[slot_index].index = index;
+}
+
+void DataModel::LinkRowSlots(const DataView* owner, const DataAddress& container_address, const Vector<int>& slots)
+{
+	views->LinkRows(owner, container_address, slots);
+}
+
+DataAddress DataModel::GetRowSlotAddress(int slot)
+{
+	return DataAddress{"#row", slot};
+}
+
+DataAddress DataModel::GetRowSlotIndexAddress(int slot)
+{
+	return DataAddress{"#row", slot, "#index"};
+}
+
+DataAddress DataModel::GetRowSlotEntryAddress(const DataAddress& address) const
+{
+	if (address.empty() || address.front().name != "#row")
+		return address;
+
+	const int slot_index = (address.size() > 1 ? address[1].index : -1);
+	if (slot_index < 0 || slot_index >= (int)row_slots.size() || !row_slots[slot_index].owner)
+		return DataAddress();
+
+	const RowSlot& slot = row_slots[slot_index];
+	DataAddress entry_address = slot.container_address;
+	entry_address.push_back(DataAddressEntry(slot.index));
+	entry_address.insert(entry_address.end(), address.begin() + 2, address.end());
+	return GetRowSlotEntryAddress(entry_address);
+}
+
 void DataModel::AttachModelRootElement(Element* element)
 {
 	attached_elements.insert(element);
@@ -395,10 +615,15 @@ void DataModel::OnElementRemove(Element* element)
 
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	views->DetectChanges(*this);
+
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+	}
 
 	return result;
 }
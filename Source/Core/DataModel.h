@@ -37,8 +37,10 @@
 
 namespace Rml {
 
+class DataView;
 class DataViews;
 class DataControllers;
+class DataExpressionCache;
 class DataVariable;
 class Element;
 class FuncDefinition;
@@ -64,14 +66,42 @@ public:
 	const DataEventFunc* GetEventCallback(const String& name);
 
 	DataVariable GetVariable(const DataAddress& address) const;
+	// Returns the top-level variable of the address if it is bound to this model, it remains valid for the lifetime of the model.
+	DataVariable GetRootVariable(const DataAddress& address) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
+	// Same as above, starting from the top-level variable of the address as returned by GetRootVariable(). Clears the value on failure.
+	bool GetVariableInto(DataVariable root_variable, const DataAddress& address, Variant& out_value) const;
+	// Returns the variable at the given entry of the address, from the variable at the previous entry. Used for resolving many addresses with
+	// common prefixes, one entry at a time. An invalid variable is returned if the entry does not exist, array indices out of bounds are not logged.
+	DataVariable GetEntryVariable(DataVariable parent, const DataAddress& address, size_t entry_index) const;
 
 	void DirtyVariable(const String& variable_name);
+	void DirtyVariable(const DataAddress& address);
+	// Dirties the top-level variable containing the given address, also when the address refers to a row slot.
+	void DirtyRootVariable(const DataAddress& address);
 	bool IsVariableDirty(const String& variable_name) const;
+	// Returns true if the given address or any variable containing it is dirty, not considering its parts.
+	bool IsAddressDirty(const DataAddress& address) const;
 	void DirtyAllVariables();
+	// Dirties the addresses of changed values automatically during update, by comparing them against snapshots taken by the data views.
+	void EnableAutoDirty(bool enable);
 
 	bool CallTransform(const String& name, const VariantList& arguments, Variant& out_result) const;
 
+	// Row slots give the rows of keyed 'data-for' views a stable address, independent of their current index in the container. The slot is
+	// released when its owner element is removed or its aliases are erased.
+	int CreateRowSlot(Element* owner, const DataAddress& container_address, int index);
+	// Moves the row to a new index in the container. The row's address is not dirtied, this is left to the caller.
+	void SetRowSlotIndex(int slot, int index);
+	// Associates the rows of the container with the given slots, such that dirtying the container's entries also dirties the rows.
+	void LinkRowSlots(const DataView* owner, const DataAddress& container_address, const Vector<int>& slots);
+	// The address of the container entry referred to by the row slot.
+	static DataAddress GetRowSlotAddress(int slot);
+	// The address of the current index of the row slot.
+	static DataAddress GetRowSlotIndexAddress(int slot);
+	// Returns the address with any row slot replaced by the container entry it currently refers to, or an empty address if the slot is invalid.
+	DataAddress GetRowSlotEntryAddress(const DataAddress& address) const;
+
 	// Elements declaring 'data-model' need to be attached.
 	void AttachModelRootElement(Element* element);
 	ElementList GetAttachedModelRootElements() const;
@@ -82,12 +112,20 @@ public:
 
 	inline DataTypeRegister* GetDataTypeRegister() const { return data_type_register; }
 
+	// Parsed data expressions, shared between views and controllers with identical expressions.
+	DataExpressionCache& GetExpressionCache() const { return *expression_cache; }
+
 private:
+	DataVariable GetChildVariable(DataVariable variable, const DataAddress& address, size_t first_entry) const;
+
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
+	UniquePtr<DataExpressionCache> expression_cache;
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	// Addresses of dirty parts of variables, the variables themselves are not dirty unless they are also in 'dirty_variables'.
+	Vector<DataAddress> dirty_addresses;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -95,6 +133,15 @@ private:
 	using ScopedAliases = UnorderedMap<Element*, SmallUnorderedMap<String, DataAddress>>;
 	ScopedAliases aliases;
 
+	struct RowSlot {
+		DataAddress container_address;
+		int index;
+		Element* owner;
+	};
+	Vector<RowSlot> row_slots;
+	Vector<int> free_row_slots;
+	UnorderedMap<Element*, int> row_slot_owners;
+
 	DataTypeRegister* data_type_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
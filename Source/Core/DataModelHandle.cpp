@@ -43,11 +43,21 @@ void DataModelHandle::DirtyVariable(const String& variable_name)
 	model->DirtyVariable(variable_name);
 }
 
+void DataModelHandle::DirtyVariable(const DataAddress& address)
+{
+	model->DirtyVariable(address);
+}
+
 void DataModelHandle::DirtyAllVariables()
 {
 	model->DirtyAllVariables();
 }
 
+void DataModelHandle::EnableAutoDirty(bool enable)
+{
+	model->EnableAutoDirty(enable);
+}
+
 DataModelConstructor::DataModelConstructor() : model(nullptr), type_register(nullptr) {}
 
 DataModelConstructor::DataModelConstructor(DataModel* model) : model(model), type_register(model->GetDataTypeRegister())
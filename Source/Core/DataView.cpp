@@ -28,6 +28,8 @@
 
 #include "DataView.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "DataModel.h"
 #include <algorithm>
 
 namespace Rml {
@@ -74,54 +76,69 @@ void DataViews::Add(DataViewPtr view)
 
 void DataViews::OnElementRemove(Element* element)
 {
-	for (auto it = views.begin(); it != views.end();)
-	{
-		auto& view = *it;
-		if (view && view->GetElement() == element)
-		{
-			views_to_remove.push_back(std::move(view));
-			it = views.erase(it);
-		}
-		else
-			++it;
-	}
+	auto range = views.equal_range(element);
+	for (auto it = range.first; it != range.second; ++it)
+		views_to_remove.push_back(std::move(it->second));
+	views.erase(range.first, range.second);
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses)
 {
 	bool result = false;
-	size_t num_dirty_variables_prev = 0;
+	size_t num_dirty_variables_processed = 0;
+	size_t num_dirty_addresses_processed = 0;
 
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
-	// updated until the next Update() call.
-	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	// updated until the next Update() call. Later iterations only consider the views and addresses
+	// added since the previous iteration, so that views are not needlessly updated twice.
+	for (int i = 0; i < 10; i++)
 	{
-		num_dirty_variables_prev = dirty_variables.size();
+		const bool new_dirty_variables = (num_dirty_variables_processed != dirty_variables.size());
+		if (i > 0 && views_to_add.empty() && !new_dirty_variables && num_dirty_addresses_processed == dirty_addresses.size())
+			break;
 
 		Vector<DataView*> dirty_views;
 
 		if (!views_to_add.empty())
 		{
-			views.reserve(views.size() + views_to_add.size());
 			for (auto&& view : views_to_add)
 			{
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
 
-				views.push_back(std::move(view));
+				Vector<AddressNode*>& address_nodes = view_address_nodes[view.get()];
+				for (const DataAddress& address : view->GetVariableAddressList())
+				{
+					if (address.empty())
+						continue;
+
+					AddressNode* node = GetOrCreateNode(address);
+					node->views.push_back(view.get());
+					address_nodes.push_back(node);
+				}
+
+				Element* element = (view->IsValid() ? view->GetElement() : nullptr);
+				views.emplace(element, std::move(view));
 			}
 			views_to_add.clear();
+			dirty_watches = true;
 		}
 
-		for (const String& variable_name : dirty_variables)
+		if (new_dirty_variables)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			for (const String& variable_name : dirty_variables)
+			{
+				auto it = address_root.members.find(variable_name);
+				if (it != address_root.members.end())
+					AddNodeViewsRecursive(*it->second, dirty_views);
+			}
+			num_dirty_variables_processed = dirty_variables.size();
 		}
 
+		// Views may dirty new addresses while updating, thus use indices and only process each address once.
+		for (; num_dirty_addresses_processed < dirty_addresses.size(); num_dirty_addresses_processed++)
+			AddDirtyViews(address_root, dirty_addresses[num_dirty_addresses_processed], 0, dirty_views);
+
 		// Remove duplicate entries
 		std::sort(dirty_views.begin(), dirty_views.end());
 		auto it_remove = std::unique(dirty_views.begin(), dirty_views.end());
@@ -142,25 +159,282 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		}
 
 		// Destroy views marked for destruction
-		// @performance: Horrible...
 		if (!views_to_remove.empty())
 		{
 			for (const auto& view : views_to_remove)
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end();)
+				auto it_nodes = view_address_nodes.find(view.get());
+				if (it_nodes != view_address_nodes.end())
+				{
+					for (AddressNode* node : it_nodes->second)
+					{
+						auto it_view = std::find(node->views.begin(), node->views.end(), view.get());
+						if (it_view != node->views.end())
+							node->views.erase(it_view);
+					}
+					view_address_nodes.erase(it_nodes);
+				}
+
+				auto it_links = view_row_links.find(view.get());
+				if (it_links != view_row_links.end())
 				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
+					Vector<RowLinks>& row_links = it_links->second->row_links;
+					row_links.erase(std::remove_if(row_links.begin(), row_links.end(),
+										[&view](const RowLinks& links) { return links.owner == view.get(); }),
+						row_links.end());
+					view_row_links.erase(it_links);
 				}
 			}
 
 			views_to_remove.clear();
+			dirty_watches = true;
 		}
 	}
 
+	if (change_detection && dirty_watches)
+		UpdateWatches(model);
+
 	return result;
 }
 
+void DataViews::LinkRows(const DataView* owner, const DataAddress& container_address, const Vector<int>& slots)
+{
+	AddressNode* container_node = GetOrCreateNode(container_address);
+
+	AddressNode*& linked_node = view_row_links[owner];
+	if (linked_node && linked_node != container_node)
+	{
+		Vector<RowLinks>& row_links = linked_node->row_links;
+		row_links.erase(std::remove_if(row_links.begin(), row_links.end(), [owner](const RowLinks& links) { return links.owner == owner; }),
+			row_links.end());
+	}
+	linked_node = container_node;
+
+	auto it_links = std::find_if(container_node->row_links.begin(), container_node->row_links.end(),
+		[owner](const RowLinks& links) { return links.owner == owner; });
+	if (it_links == container_node->row_links.end())
+		it_links = container_node->row_links.insert(it_links, RowLinks{owner, {}});
+
+	// Row slots are addressed as '#row[slot]', see DataModel::GetRowSlotAddress().
+	UniquePtr<AddressNode>& slots_node = address_root.members["#row"];
+	if (!slots_node)
+		slots_node = MakeUnique<AddressNode>();
+
+	Vector<AddressNode*>& rows = it_links->rows;
+	rows.resize(slots.size());
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		UniquePtr<AddressNode>& row_node = slots_node->indices[slots[i]];
+		if (!row_node)
+			row_node = MakeUnique<AddressNode>();
+		rows[i] = row_node.get();
+	}
+}
+
+void DataViews::SetChangeDetection(bool enable)
+{
+	if (enable == change_detection)
+		return;
+
+	change_detection = enable;
+	dirty_watches = true;
+
+	if (!enable)
+	{
+		for (Watch& watch : watches)
+			watch.node->watch_index = -1;
+		watches.clear();
+		watches.shrink_to_fit();
+	}
+}
+
+void DataViews::DetectChanges(DataModel& model)
+{
+	if (change_detection)
+		ReadWatches(model, true);
+}
+
+void DataViews::UpdateWatches(DataModel& model)
+{
+	Vector<Watch> previous_watches = std::move(watches);
+	watches.clear();
+	watches.reserve(previous_watches.size());
+
+	DataAddress address;
+	AddWatchesRecursive(address_root, address, previous_watches);
+
+	// Take snapshots of the new watches, the views have just been updated with the same values.
+	ReadWatches(model, false);
+	dirty_watches = false;
+}
+
+void DataViews::AddWatchesRecursive(AddressNode& node, DataAddress& address, Vector<Watch>& previous_watches)
+{
+	// Row indices are not watched, they are dirtied by their 'data-for' view whenever they change.
+	const bool is_row_index = (!address.empty() && address.back().name == "#index");
+
+	if (!node.views.empty() && !is_row_index)
+	{
+		Watch watch = {&node, address, 0, false, Variant()};
+		if (node.watch_index >= 0)
+		{
+			Watch& previous_watch = previous_watches[node.watch_index];
+			watch.has_value = previous_watch.has_value;
+			watch.value = std::move(previous_watch.value);
+		}
+
+		if (!watches.empty())
+		{
+			const DataAddress& previous_address = watches.back().address;
+			const size_t max_shared = Math::Min(address.size(), previous_address.size());
+			while (watch.shared_prefix < max_shared && address[watch.shared_prefix].index == previous_address[watch.shared_prefix].index &&
+				address[watch.shared_prefix].name == previous_address[watch.shared_prefix].name)
+				watch.shared_prefix += 1;
+		}
+
+		node.watch_index = int(watches.size());
+		watches.push_back(std::move(watch));
+	}
+	else
+	{
+		node.watch_index = -1;
+	}
+
+	for (auto& member : node.members)
+	{
+		address.push_back(DataAddressEntry(member.first));
+		AddWatchesRecursive(*member.second, address, previous_watches);
+		address.pop_back();
+	}
+	for (auto& index : node.indices)
+	{
+		address.push_back(DataAddressEntry(index.first));
+		AddWatchesRecursive(*index.second, address, previous_watches);
+		address.pop_back();
+	}
+}
+
+void DataViews::ReadWatches(DataModel& model, bool dirty_changed_values)
+{
+	// The number of entries in the resolved variables which are shared with the current address.
+	size_t num_resolved = 0;
+
+	for (Watch& watch : watches)
+	{
+		num_resolved = Math::Min(num_resolved, watch.shared_prefix);
+		if (!dirty_changed_values && watch.has_value)
+			continue;
+
+		// Resolve only the entries which differ from the previously resolved address.
+		const DataAddress& address = watch.address;
+		watch_variables.resize(Math::Max(watch_variables.size(), address.size()));
+		for (size_t i = num_resolved; i < address.size(); i++)
+			watch_variables[i] = model.GetEntryVariable(i == 0 ? DataVariable() : watch_variables[i - 1], address, i);
+
+		num_resolved = address.size();
+
+		// Arrays are compared by their size, their entries are watched separately by the views depending on them.
+		DataVariable variable = watch_variables[address.size() - 1];
+		if (!variable)
+		{
+			watch_value.Clear();
+		}
+		else
+		{
+			switch (variable.Type())
+			{
+			case DataVariableType::Scalar:
+				if (!variable.Get(watch_value))
+					watch_value.Clear();
+				break;
+			case DataVariableType::Array: watch_value = variable.Size(); break;
+			case DataVariableType::Struct: watch_value.Clear(); break;
+			}
+		}
+
+		if (watch.has_value && watch_value == watch.value)
+			continue;
+
+		const bool changed = watch.has_value;
+		std::swap(watch.value, watch_value);
+		watch.has_value = true;
+
+		if (changed && dirty_changed_values)
+		{
+			// Dirty the container entry rather than the row slot, so that views depending on the container, such as keyed 'data-for' views,
+			// are also updated.
+			const DataAddress entry_address = model.GetRowSlotEntryAddress(address);
+			if (!entry_address.empty())
+				model.DirtyVariable(entry_address);
+		}
+	}
+}
+
+DataViews::AddressNode* DataViews::GetOrCreateNode(const DataAddress& address)
+{
+	AddressNode* node = &address_root;
+	for (const DataAddressEntry& entry : address)
+	{
+		UniquePtr<AddressNode>& child = (entry.index >= 0 ? node->indices[entry.index] : node->members[entry.name]);
+		if (!child)
+			child = MakeUnique<AddressNode>();
+		node = child.get();
+	}
+	return node;
+}
+
+void DataViews::AddDirtyViews(const AddressNode& start_node, const DataAddress& address, size_t first_entry, Vector<DataView*>& dirty_views)
+{
+	// Views depending on a variable containing the address are dirty, such as the views of a whole array when one of its entries changes.
+	const AddressNode* node = &start_node;
+	for (size_t i = first_entry; i < address.size(); i++)
+	{
+		const DataAddressEntry& entry = address[i];
+		dirty_views.insert(dirty_views.end(), node->views.begin(), node->views.end());
+
+		const UniquePtr<AddressNode>* child = nullptr;
+		if (entry.index >= 0)
+		{
+			// Continue along any rows referring to this entry through their row slot.
+			for (const RowLinks& links : node->row_links)
+			{
+				if (entry.index < (int)links.rows.size())
+					AddDirtyViews(*links.rows[entry.index], address, i + 1, dirty_views);
+			}
+
+			auto it = node->indices.find(entry.index);
+			if (it != node->indices.end())
+				child = &it->second;
+		}
+		else
+		{
+			auto it = node->members.find(entry.name);
+			if (it != node->members.end())
+				child = &it->second;
+		}
+
+		if (!child)
+			return;
+		node = child->get();
+	}
+
+	// Views depending on the address itself or on any part of it are dirty.
+	AddNodeViewsRecursive(*node, dirty_views);
+}
+
+void DataViews::AddNodeViewsRecursive(const AddressNode& node, Vector<DataView*>& dirty_views)
+{
+	dirty_views.insert(dirty_views.end(), node.views.begin(), node.views.end());
+
+	for (const auto& member : node.members)
+		AddNodeViewsRecursive(*member.second, dirty_views);
+	for (const auto& index : node.indices)
+		AddNodeViewsRecursive(*index.second, dirty_views);
+	for (const RowLinks& links : node.row_links)
+	{
+		for (const AddressNode* row : links.rows)
+			AddNodeViewsRecursive(*row, dirty_views);
+	}
+}
+
 } // namespace Rml
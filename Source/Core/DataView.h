@@ -30,6 +30,7 @@
 #define RMLUI_CORE_DATAVIEW_H
 
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/Types.h"
@@ -79,8 +80,9 @@ public:
 	// Returns true if the update resulted in a document change.
 	virtual bool Update(DataModel& model) = 0;
 
-	// Returns the list of data variable name(s) which can modify this view.
-	virtual StringList GetVariableNameList() const = 0;
+	// Returns the addresses of the data variables which can modify this view.
+	// The view is updated when any of these addresses are dirtied, including when a part of it or a variable containing it is dirtied.
+	virtual Vector<DataAddress> GetVariableAddressList() const = 0;
 
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
@@ -112,18 +114,78 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Updates the views depending on the dirty variables, and on the dirty parts of variables given by their addresses.
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses);
+
+	// Links the entries of a container to the row slot addresses given for each index, replacing any previous links made by the same owner.
+	void LinkRows(const DataView* owner, const DataAddress& container_address, const Vector<int>& slots);
+
+	// Enables change detection, where a snapshot is kept of the value at each address the views depend on.
+	void SetChangeDetection(bool enable);
+	// Dirties the addresses whose values have changed since the previous call, or since their views were added.
+	void DetectChanges(DataModel& model);
 
 private:
+	struct AddressNode;
+	struct RowLinks {
+		const DataView* owner;
+		Vector<AddressNode*> rows;
+	};
+
+	// Views indexed by the addresses they depend on, as a tree with one level for each entry of the addresses.
+	struct AddressNode {
+		Vector<DataView*> views;
+		UnorderedMap<String, UniquePtr<AddressNode>> members;
+		UnorderedMap<int, UniquePtr<AddressNode>> indices;
+		// The row slots referring to the entries of this container, by index.
+		Vector<RowLinks> row_links;
+		// Index into the watches when change detection is enabled and the node has any views, otherwise -1.
+		int watch_index = -1;
+	};
+
+	// The snapshot of the value at an address which views depend on.
+	struct Watch {
+		AddressNode* node;
+		DataAddress address;
+		// The number of leading address entries shared with the previous watch, these entries are only resolved once when reading the values.
+		size_t shared_prefix;
+		bool has_value;
+		Variant value;
+	};
+
+	AddressNode* GetOrCreateNode(const DataAddress& address);
+
+	// Adds the views depending on the given address, or on any part of it, or on a variable containing it.
+	static void AddDirtyViews(const AddressNode& node, const DataAddress& address, size_t first_entry, Vector<DataView*>& dirty_views);
+	static void AddNodeViewsRecursive(const AddressNode& node, Vector<DataView*>& dirty_views);
+
+	// Rebuilds the watches from the address nodes with views, keeping the snapshots of existing watches and taking snapshots for new ones.
+	void UpdateWatches(DataModel& model);
+	void AddWatchesRecursive(AddressNode& node, DataAddress& address, Vector<Watch>& previous_watches);
+	// Reads the current value of each watch, and dirties the addresses of changed values if requested.
+	void ReadWatches(DataModel& model, bool dirty_changed_values);
+
 	using DataViewList = Vector<DataViewPtr>;
+	using ElementViewsMap = UnorderedMultimap<Element*, DataViewPtr>;
 
-	DataViewList views;
+	ElementViewsMap views;
 
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	AddressNode address_root;
+	// The address nodes of each view, for removing the view from the tree.
+	UnorderedMap<DataView*, Vector<AddressNode*>> view_address_nodes;
+	// The container node linked by each view, for removing its row links.
+	UnorderedMap<const DataView*, AddressNode*> view_row_links;
+
+	bool change_detection = false;
+	bool dirty_watches = false;
+	// Watches in depth-first order of their address nodes, so that consecutive watches share the longest possible address prefixes.
+	Vector<Watch> watches;
+	// The variable of each entry of the most recently read address.
+	Vector<DataVariable> watch_variables;
+	Variant watch_value;
 };
 
 } // namespace Rml
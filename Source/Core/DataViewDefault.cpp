@@ -36,6 +36,7 @@
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataExpression.h"
 #include "DataModel.h"
+#include "RmlFragment.h"
 #include "XMLParseTools.h"
 
 namespace Rml {
@@ -63,10 +64,10 @@ bool DataViewCommon::Initialize(DataModel& model, Element* element, const String
 	return result;
 }
 
-StringList DataViewCommon::GetVariableNameList() const
+Vector<DataAddress> DataViewCommon::GetVariableAddressList() const
 {
 	RMLUI_ASSERT(expression);
-	return expression->GetVariableNameList();
+	return expression->GetVariableAddressList();
 }
 
 const String& DataViewCommon::GetModifier() const
@@ -407,17 +408,17 @@ bool DataViewText::Update(DataModel& model)
 	return entries_modified;
 }
 
-StringList DataViewText::GetVariableNameList() const
+Vector<DataAddress> DataViewText::GetVariableAddressList() const
 {
-	StringList full_list;
+	Vector<DataAddress> full_list;
 	full_list.reserve(data_entries.size());
 
 	for (const DataEntry& entry : data_entries)
 	{
 		RMLUI_ASSERT(entry.data_expression);
 
-		StringList entry_list = entry.data_expression->GetVariableNameList();
-		full_list.insert(full_list.end(), MakeMoveIterator(entry_list.begin()), MakeMoveIterator(entry_list.end()));
+		const AddressList& entry_list = entry.data_expression->GetVariableAddressList();
+		full_list.insert(full_list.end(), entry_list.begin(), entry_list.end());
 	}
 
 	return full_list;
@@ -456,7 +457,8 @@ DataViewFor::DataViewFor(Element* element) : DataView(element, 0) {}
 
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
 {
-	rml_contents = in_rml_content;
+	// The contents are parsed once, and then instanced for each new row.
+	rml_fragment = MakeUnique<RmlFragment>(in_rml_content);
 
 	StringList iterator_container_pair;
 	StringUtilities::ExpandString(iterator_container_pair, in_expression, ':');
@@ -505,12 +507,23 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 
 	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
 	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+	attributes.erase("data-for");
+	attributes.erase("data-for-key");
+
+	const String key_expression_str = element->GetAttribute<String>("data-for-key", String());
+	if (!key_expression_str.empty())
 	{
-		if (it->first == "data-for")
+		// The key expression is resolved against the iterator aliases of the probe slot, which lives on this element.
+		probe_slot = model.CreateRowSlot(element, container_address, 0);
+		model.InsertAlias(element, iterator_name, DataModel::GetRowSlotAddress(probe_slot));
+		model.InsertAlias(element, iterator_index_name, DataModel::GetRowSlotIndexAddress(probe_slot));
+
+		key_expression = MakeUnique<DataExpression>(key_expression_str);
+		DataExpressionInterface expr_interface(&model, element);
+		if (!key_expression->Parse(expr_interface, false))
 		{
-			attributes.erase(it);
-			break;
+			Log::Message(Log::LT_WARNING, "Invalid key expression in data-for-key '%s'", key_expression_str.c_str());
+			return false;
 		}
 	}
 
@@ -523,6 +536,9 @@ bool DataViewFor::Update(DataModel& model)
 	if (!variable)
 		return false;
 
+	if (key_expression)
+		return UpdateKeyed(model, variable);
+
 	bool result = false;
 	const int size = variable.Size();
 	const int num_elements = (int)elements.size();
@@ -547,7 +563,7 @@ bool DataViewFor::Update(DataModel& model)
 			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
 			elements.push_back(new_element);
 
-			elements[i]->SetInnerRML(rml_contents);
+			rml_fragment->Instance(elements[i]);
 
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
@@ -565,10 +581,109 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
-StringList DataViewFor::GetVariableNameList() const
+bool DataViewFor::UpdateKeyed(DataModel& model, DataVariable variable)
+{
+	const int size = variable.Size();
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	StringList new_keys(size);
+	DataExpressionInterface expr_interface(&model, element);
+	Variant key;
+	for (int i = 0; i < size; i++)
+	{
+		model.SetRowSlotIndex(probe_slot, i);
+		if (key_expression->Run(expr_interface, key))
+			new_keys[i] = key.Get<String>();
+		key.Clear();
+	}
+
+	// Any changes to the contents of the rows are handled by their own views.
+	if (new_keys == keys)
+		return false;
+
+	// The views of moved rows need to be updated, unless they are already dirty through the container.
+	const bool container_dirty = model.IsAddressDirty(container_address);
+
+	// Match the new keys against the old ones, the first row of each old key is retained, any duplicates are recreated.
+	UnorderedMap<String, int> old_indices;
+	old_indices.reserve(keys.size());
+	for (int i = 0; i < (int)keys.size(); i++)
+		old_indices.emplace(keys[i], i);
+
+	ElementList new_elements(size, nullptr);
+	Vector<int> new_slots(size, -1);
+	for (int i = 0; i < size; i++)
+	{
+		auto it = old_indices.find(new_keys[i]);
+		if (it == old_indices.end() || it->second < 0)
+			continue;
+
+		const int old_index = it->second;
+		it->second = -1;
+
+		new_elements[i] = elements[old_index];
+		new_slots[i] = slots[old_index];
+		elements[old_index] = nullptr;
+
+		if (old_index != i)
+		{
+			model.SetRowSlotIndex(new_slots[i], i);
+			if (!container_dirty)
+				model.DirtyVariable(DataModel::GetRowSlotAddress(new_slots[i]));
+		}
+	}
+
+	for (Element* old_element : elements)
+	{
+		if (old_element)
+		{
+			model.EraseAliases(old_element);
+			parent->RemoveChild(old_element).reset();
+		}
+	}
+
+	for (int i = 0; i < size; i++)
+	{
+		if (new_elements[i])
+			continue;
+
+		ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+		const int slot = model.CreateRowSlot(new_element_ptr.get(), container_address, i);
+		model.InsertAlias(new_element_ptr.get(), iterator_name, DataModel::GetRowSlotAddress(slot));
+		model.InsertAlias(new_element_ptr.get(), iterator_index_name, DataModel::GetRowSlotIndexAddress(slot));
+
+		new_elements[i] = parent->InsertBefore(std::move(new_element_ptr), element);
+		rml_fragment->Instance(new_elements[i]);
+		new_slots[i] = slot;
+	}
+
+	parent->ReorderChildren(new_elements);
+
+	elements = std::move(new_elements);
+	slots = std::move(new_slots);
+	keys = std::move(new_keys);
+
+	model.LinkRowSlots(this, container_address, slots);
+
+	return true;
+}
+
+Vector<DataAddress> DataViewFor::GetVariableAddressList() const
 {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{container_address.front().name};
+	Vector<DataAddress> list = {container_address};
+	if (key_expression)
+	{
+		// Addresses through the probe slot are covered by the container.
+		for (const DataAddress& address : key_expression->GetVariableAddressList())
+		{
+			if (address.front().name != "#row")
+				list.push_back(address);
+		}
+	}
+	return list;
 }
 
 void DataViewFor::Release()
@@ -578,9 +693,13 @@ void DataViewFor::Release()
 
 DataViewAlias::DataViewAlias(Element* element) : DataView(element, 0) {}
 
-StringList DataViewAlias::GetVariableNameList() const
+Vector<DataAddress> DataViewAlias::GetVariableAddressList() const
 {
-	return variables;
+	Vector<DataAddress> list;
+	list.reserve(variables.size());
+	for (const String& variable : variables)
+		list.push_back(DataAddress{DataAddressEntry(variable)});
+	return list;
 }
 
 bool DataViewAlias::Update(DataModel&)
@@ -38,6 +38,8 @@ namespace Rml {
 
 class Element;
 class DataExpression;
+class DataVariable;
+class RmlFragment;
 using DataExpressionPtr = UniquePtr<DataExpression>;
 
 class DataViewCommon : public DataView {
@@ -46,7 +48,7 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	const String& GetModifier() const;
@@ -132,7 +134,7 @@ public:
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
 	bool Update(DataModel& model) override;
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
@@ -158,25 +160,34 @@ public:
 
 	bool Update(DataModel& model) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
 
 private:
+	// Updates the rows by their keys given by the 'data-for-key' expression, retaining the elements of existing keys.
+	bool UpdateKeyed(DataModel& model, DataVariable variable);
+
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
-	String rml_contents;
+	UniquePtr<RmlFragment> rml_fragment;
 	ElementAttributes attributes;
 
 	ElementList elements;
+
+	// Keyed views only. The key expression is evaluated for each entry in the container by moving the probe slot over it.
+	DataExpressionPtr key_expression;
+	int probe_slot = -1;
+	Vector<int> slots;
+	StringList keys;
 };
 
 class DataViewAlias final : public DataView {
 public:
 	DataViewAlias(Element* element);
-	virtual StringList GetVariableNameList() const override;
+	virtual Vector<DataAddress> GetVariableAddressList() const override;
 	bool Update(DataModel& model) override;
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
@@ -42,6 +42,7 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "ClipRegionCache.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -52,10 +53,12 @@
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "Layout/LayoutCache.h"
 #include "Layout/LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "Pool.h"
 #include "PropertiesIterator.h"
+#include "StyleSheetInvalidationSets.h"
 #include "StyleSheetNode.h"
 #include "StyleSheetParser.h"
 #include "TransformState.h"
@@ -100,14 +103,37 @@ struct ElementMeta {
 	ElementEffects effects;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	LayoutCache layout_cache;
+	ClipRegionCache clip_region_cache;
 };
 
 static Pool<ElementMeta> element_meta_chunk_pool(200, true);
 
+// Returns the elements affected by a change to the given name of the element, or all elements when it is not attached to any style sheet.
+static InvalidationFlags GetInvalidationFlags(const Element* element, StyleSheetInvalidationSets::NameType type, const String& name)
+{
+	const StyleSheet* style_sheet = element->GetStyleSheet();
+	if (!style_sheet)
+		return InvalidationFlags::All;
+
+	const StyleSheetInvalidationSets& invalidation_sets = style_sheet->GetInvalidationSets();
+	if (!invalidation_sets.Contains(type, name))
+		return InvalidationFlags::None;
+
+	AncestorFilter element_names;
+	element_names.AddElement(element->GetTagName(), element->GetId(), element->GetStyle()->GetClassNameList());
+	if (type == StyleSheetInvalidationSets::Id)
+		element_names.Add(AncestorFilter::NameType::Id, name);
+	else if (type == StyleSheetInvalidationSets::Class)
+		element_names.Add(AncestorFilter::NameType::Class, name);
+
+	return invalidation_sets.Get(type, name, element_names);
+}
+
 Element::Element(const String& tag) :
 	local_stacking_context(false), local_stacking_context_forced(false), stacking_context_dirty(false), computed_values_are_default_initialized(true),
-	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_animation(false),
-	dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0),
+	visible(true), offset_fixed(false), absolute_offset_dirty(true), dirty_definition(false), dirty_child_definitions(false), dirty_update(true),
+	dirty_child_update(false), dirty_animation(false), dirty_transition(false), dirty_transform(false), dirty_perspective(false), tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0),
 	absolute_offset(0, 0), scroll_offset(0, 0)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
@@ -159,6 +185,8 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	dirty_update = false;
+
 	OnUpdate();
 
 	HandleTransitionProperty();
@@ -179,13 +207,34 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->effects.InstanceEffects();
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	// Skip all subtrees without any pending changes. The flag is kept set while updating the children, so that any elements dirtied in the
+	// meantime don't propagate further up the tree, then it is refreshed from the children's state afterward.
+	if (dirty_child_update)
+	{
+		auto NeedsUpdate = [](const ElementPtr& child) { return child->dirty_update || child->dirty_child_update; };
 
-	if (!animations.empty() && IsVisible(true))
+		for (size_t i = 0; i < children.size(); i++)
+		{
+			if (NeedsUpdate(children[i]))
+			{
+				children[i]->meta->style.SetChildIndexHint((int)i);
+				children[i]->Update(dp_ratio, vp_dimensions);
+			}
+		}
+
+		dirty_child_update = std::any_of(children.begin(), children.end(), NeedsUpdate);
+	}
+
+	if (!animations.empty())
 	{
-		if (Context* ctx = GetContext())
-			ctx->RequestNextUpdate(0);
+		// Animations need to advance during every update loop.
+		DirtyUpdate();
+
+		if (IsVisible(true))
+		{
+			if (Context* ctx = GetContext())
+				ctx->RequestNextUpdate(0);
+		}
 	}
 }
 
@@ -295,7 +344,7 @@ ElementPtr Element::Clone() const
 void Element::SetClass(const String& class_name, bool activate)
 {
 	if (meta->style.SetClass(class_name, activate))
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		DirtyDefinition(GetInvalidationFlags(this, StyleSheetInvalidationSets::Class, class_name));
 }
 
 bool Element::IsClassSet(const String& class_name) const
@@ -421,7 +470,11 @@ Vector2f Element::GetAbsoluteOffset(BoxArea area)
 
 void Element::SetClipArea(BoxArea _clip_area)
 {
-	clip_area = _clip_area;
+	if (clip_area != _clip_area)
+	{
+		clip_area = _clip_area;
+		ClipRegionCache::DirtyAll();
+	}
 }
 
 BoxArea Element::GetClipArea() const
@@ -434,6 +487,7 @@ void Element::SetScrollableOverflowRectangle(Vector2f _scrollable_overflow_recta
 	if (scrollable_overflow_rectangle != _scrollable_overflow_rectangle)
 	{
 		scrollable_overflow_rectangle = _scrollable_overflow_rectangle;
+		ClipRegionCache::DirtyAll();
 		if (clamp_scroll_offset)
 			ClampScrollOffset();
 	}
@@ -445,6 +499,7 @@ void Element::SetBox(const Box& box)
 	{
 		main_box = box;
 		additional_boxes.clear();
+		ClipRegionCache::DirtyAll();
 
 		OnResize();
 
@@ -686,6 +741,16 @@ const TransformState* Element::GetTransformState() const noexcept
 	return transform_state.get();
 }
 
+LayoutCache* Element::GetLayoutCache() const
+{
+	return &meta->layout_cache;
+}
+
+ClipRegionCache* Element::GetClipRegionCache() const
+{
+	return &meta->clip_region_cache;
+}
+
 bool Element::Project(Vector2f& point) const noexcept
 {
 	if (!transform_state || !transform_state->GetTransform())
@@ -734,8 +799,7 @@ void Element::SetPseudoClass(const String& pseudo_class, bool activate)
 {
 	if (meta->style.SetPseudoClass(pseudo_class, activate, false))
 	{
-		// Include siblings in case of RCSS presence of sibling combinators '+', '~'.
-		DirtyDefinition(DirtyNodes::SelfAndSiblings);
+		DirtyDefinition(GetInvalidationFlags(this, StyleSheetInvalidationSets::PseudoClass, pseudo_class));
 		OnPseudoClassChange(pseudo_class, activate);
 	}
 }
@@ -1288,7 +1352,7 @@ Element* Element::AppendChild(ElementPtr child, bool dom_element)
 	DirtyDefinition(DirtyNodes::Self);
 
 	if (dom_element)
-		DirtyLayout();
+		DirtyLayoutFrom(this);
 
 	return child_ptr;
 }
@@ -1322,7 +1386,7 @@ Element* Element::InsertBefore(ElementPtr child, Element* adjacent_element)
 		if ((int)child_index >= GetNumChildren())
 			num_non_dom_children++;
 		else
-			DirtyLayout();
+			DirtyLayoutFrom(this);
 
 		children.insert(children.begin() + child_index, std::move(child));
 		child_ptr->SetParent(this);
@@ -1415,7 +1479,7 @@ ElementPtr Element::RemoveChild(Element* child)
 
 			detached_child->SetParent(nullptr);
 
-			DirtyLayout();
+			DirtyLayoutFrom(this);
 			DirtyStackingContext();
 			DirtyDefinition(DirtyNodes::Self);
 
@@ -1428,6 +1492,48 @@ ElementPtr Element::RemoveChild(Element* child)
 	return nullptr;
 }
 
+void Element::ReorderChildren(const ElementList& ordered_children)
+{
+	// Take the children out of their current positions, the positions are then refilled in the new order.
+	UnorderedMap<Element*, ElementPtr> taken_children;
+	taken_children.reserve(ordered_children.size());
+	for (Element* child : ordered_children)
+		taken_children.emplace(child, nullptr);
+
+	Vector<size_t> positions;
+	positions.reserve(ordered_children.size());
+
+	bool order_changed = false;
+	const size_t num_dom_children = children.size() - num_non_dom_children;
+	for (size_t i = 0; i < num_dom_children && positions.size() < ordered_children.size(); i++)
+	{
+		if (taken_children.count(children[i].get()) == 1)
+		{
+			order_changed |= (ordered_children[positions.size()] != children[i].get());
+			positions.push_back(i);
+		}
+	}
+
+	if (positions.size() != ordered_children.size())
+	{
+		RMLUI_ERRORMSG("All reordered elements must be DOM children of this element.");
+		return;
+	}
+
+	if (!order_changed)
+		return;
+
+	for (size_t position : positions)
+		taken_children[children[position].get()] = std::move(children[position]);
+
+	for (size_t i = 0; i < positions.size(); i++)
+		children[positions[i]] = std::move(taken_children[ordered_children[i]]);
+
+	DirtyLayoutFrom(this);
+	DirtyStackingContext();
+	DirtyDefinition(DirtyNodes::Self);
+}
+
 bool Element::HasChildNodes() const
 {
 	return (int)children.size() > num_non_dom_children;
@@ -1615,17 +1721,30 @@ void Element::OnStyleSheetChange() {}
 
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	// Any change to the attributes may affect which styles apply to the current element, in particular due to attribute selectors, ID selectors, and
+	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators.
+	InvalidationFlags invalidation_flags = InvalidationFlags::None;
+
 	for (const auto& element_attribute : changed_attributes)
 	{
 		const auto& attribute = element_attribute.first;
 		const auto& value = element_attribute.second;
+
+		invalidation_flags |= GetInvalidationFlags(this, StyleSheetInvalidationSets::Attribute, attribute);
+
 		if (attribute == "id")
 		{
+			invalidation_flags |= GetInvalidationFlags(this, StyleSheetInvalidationSets::Id, id);
 			id = value.Get<String>();
+			invalidation_flags |= GetInvalidationFlags(this, StyleSheetInvalidationSets::Id, id);
 		}
 		else if (attribute == "class")
 		{
+			for (const String& class_name : meta->style.GetClassNameList())
+				invalidation_flags |= GetInvalidationFlags(this, StyleSheetInvalidationSets::Class, class_name);
 			meta->style.SetClassNames(value.Get<String>());
+			for (const String& class_name : meta->style.GetClassNameList())
+				invalidation_flags |= GetInvalidationFlags(this, StyleSheetInvalidationSets::Class, class_name);
 		}
 		else if (((attribute == "colspan" || attribute == "rowspan") && meta->computed_values.display() == Style::Display::TableCell) ||
 			(attribute == "span" &&
@@ -1704,9 +1823,7 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 		}
 	}
 
-	// Any change to the attributes may affect which styles apply to the current element, in particular due to attribute selectors, ID selectors, and
-	// class selectors. This can further affect all siblings or descendants due to sibling or descendant combinators.
-	DirtyDefinition(DirtyNodes::SelfAndSiblings);
+	DirtyDefinition(invalidation_flags);
 }
 
 void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
@@ -1719,8 +1836,8 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::Left)      //
 	);
 
-	// See if the document layout needs to be updated.
-	if (!IsLayoutDirty())
+	// See if the document layout needs to be updated. Always dirty the layout even when the document is already dirty, so
+	// that any cached layout results of this element and its ancestors are cleared.
 	{
 		// Force a relayout if any of the changed properties require it.
 		const PropertyIdSet changed_properties_forcing_layout =
@@ -1840,6 +1957,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (border_radius_changed || filter_or_mask_changed || changed_properties.Contains(PropertyId::Decorator))
 	{
 		meta->effects.DirtyEffects();
+		DirtyUpdate();
 	}
 
 	// Dirty the effects data when their visual looks may have changed.
@@ -1850,6 +1968,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		meta->effects.DirtyEffectsData();
 	}
 
+	// Check for changes to any properties used when finding the clipping region of this element or its descendants.
+	if (border_radius_changed || changed_properties.Contains(PropertyId::OverflowX) || changed_properties.Contains(PropertyId::OverflowY) ||
+		changed_properties.Contains(PropertyId::Clip))
+	{
+		ClipRegionCache::DirtyAll();
+	}
+
 	// Check for `perspective' and `perspective-origin' changes
 	if (changed_properties.Contains(PropertyId::Perspective) ||        //
 		changed_properties.Contains(PropertyId::PerspectiveOriginX) || //
@@ -1871,11 +1996,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
 		dirty_animation = true;
+		DirtyUpdate();
 	}
 	// Check for `transition' changes
 	if (changed_properties.Contains(PropertyId::Transition))
 	{
 		dirty_transition = true;
+		DirtyUpdate();
 	}
 }
 
@@ -1887,8 +2014,30 @@ void Element::OnChildRemove(Element* /*child*/) {}
 
 void Element::DirtyLayout()
 {
-	if (Element* document = GetOwnerDocument())
-		document->DirtyLayout();
+	meta->layout_cache.Clear();
+
+	// Changes to our own layout may affect our parent, thus start looking for a layout boundary from there.
+	DirtyLayoutFrom(GetParentNode());
+}
+
+void Element::DirtyLayoutFrom(Element* element)
+{
+	// The cached layout results of the element and all its ancestors may depend on the changed layout.
+	for (Element* ancestor = element; ancestor; ancestor = ancestor->parent)
+		ancestor->meta->layout_cache.Clear();
+
+	ElementDocument* document = GetOwnerDocument();
+	if (!document)
+		return;
+
+	Element* document_element = document;
+	if (document_element->IsLayoutDirty())
+		return;
+
+	if (Element* layout_boundary = LayoutEngine::FindLayoutBoundary(element))
+		document->DirtyLayoutBoundary(layout_boundary);
+	else
+		document_element->DirtyLayout();
 }
 
 bool Element::IsLayoutDirty()
@@ -2110,6 +2259,8 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	ClipRegionCache::DirtyAll();
+
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
@@ -2384,13 +2535,35 @@ void Element::DirtyDefinition(DirtyNodes dirty_nodes)
 {
 	switch (dirty_nodes)
 	{
-	case DirtyNodes::Self: dirty_definition = true; break;
-	case DirtyNodes::SelfAndSiblings:
+	case DirtyNodes::Self: DirtyDefinition(InvalidationFlags::Self | InvalidationFlags::Descendants); break;
+	case DirtyNodes::SelfAndSiblings: DirtyDefinition(InvalidationFlags::All); break;
+	}
+}
+
+void Element::DirtyDefinition(InvalidationFlags invalidation_flags)
+{
+	if (invalidation_flags == InvalidationFlags::None)
+		return;
+
+	if (invalidation_flags & InvalidationFlags::Self)
 		dirty_definition = true;
-		if (parent)
-			parent->dirty_child_definitions = true;
-		break;
+	if (invalidation_flags & InvalidationFlags::Descendants)
+		dirty_child_definitions = true;
+	if ((invalidation_flags & InvalidationFlags::Siblings) && parent)
+	{
+		parent->dirty_child_definitions = true;
+		parent->DirtyUpdate();
 	}
+
+	DirtyUpdate();
+}
+
+void Element::DirtyUpdate()
+{
+	dirty_update = true;
+
+	for (Element* ancestor = parent; ancestor && !ancestor->dirty_child_update; ancestor = ancestor->parent)
+		ancestor->dirty_child_update = true;
 }
 
 void Element::UpdateDefinition()
@@ -2398,20 +2571,20 @@ void Element::UpdateDefinition()
 	if (dirty_definition)
 	{
 		dirty_definition = false;
-
-		// Dirty definition implies all our descendent elements. Anything that can change the definition of this element can also change the
-		// definition of any descendants due to the presence of RCSS descendant or child combinators. In principle this also applies to sibling
-		// combinators, but those are handled during the DirtyDefinition call.
-		dirty_child_definitions = true;
-
 		GetStyle()->UpdateDefinition();
 	}
 
+	// Any descendants affected by changes to this element are dirtied explicitly during the DirtyDefinition call, as determined by the presence of
+	// RCSS descendant or child combinators.
 	if (dirty_child_definitions)
 	{
 		dirty_child_definitions = false;
 		for (const ElementPtr& child : children)
+		{
 			child->dirty_definition = true;
+			child->dirty_child_definitions = true;
+			child->DirtyUpdate();
+		}
 	}
 }
 
@@ -2498,6 +2671,7 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 		ElementAnimationOrigin origin = (initiated_by_animation_property ? ElementAnimationOrigin::Animation : ElementAnimationOrigin::User);
 		double start_time = Clock::GetElapsedTime() + (double)delay;
 		*it = ElementAnimation{property_id, origin, value, *this, start_time, 0.0f, num_iterations, alternate_direction};
+		DirtyUpdate();
 	}
 
 	if (!it->IsInitalized())
@@ -2732,6 +2906,7 @@ void Element::AdvanceAnimations()
 
 void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 {
+	ClipRegionCache::DirtyAll();
 	dirty_perspective |= perspective_dirty;
 	dirty_transform |= transform_dirty;
 }
@@ -2893,6 +3068,7 @@ void Element::UpdateTransformState()
 void Element::OnStyleSheetChangeRecursive()
 {
 	meta->effects.DirtyEffects();
+	DirtyUpdate();
 
 	OnStyleSheetChange();
 
@@ -2905,6 +3081,7 @@ void Element::OnStyleSheetChangeRecursive()
 void Element::OnDpRatioChangeRecursive()
 {
 	meta->effects.DirtyEffects();
+	DirtyUpdate();
 	GetStyle()->DirtyPropertiesWithUnits(Unit::DP_SCALABLE_LENGTH);
 
 	OnDpRatioChange();
@@ -37,6 +37,7 @@
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "Layout/LayoutCache.h"
 #include "Layout/LayoutDetails.h"
 #include "Layout/LayoutEngine.h"
 #include "StreamFile.h"
@@ -44,6 +45,7 @@
 #include "Template.h"
 #include "TemplateCache.h"
 #include "XMLParseTools.h"
+#include <algorithm>
 #include <limits.h>
 
 namespace Rml {
@@ -532,6 +534,47 @@ void ElementDocument::UpdateLayout()
 		// Ignore dirtied layout during document formatting. Layouting must not require re-iteration.
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
+		dirty_layout_boundaries.clear();
+	}
+	else if (!dirty_layout_boundaries.empty())
+	{
+		RMLUI_ZoneScopedN("UpdateLayoutBoundaries");
+
+		// Move the list to a local copy, so that any layout dirtied during formatting is ignored like above.
+		Vector<ObserverPtr<Element>> layout_boundaries = std::move(dirty_layout_boundaries);
+		dirty_layout_boundaries.clear();
+
+		auto IsDirtyLayoutBoundary = [&layout_boundaries](Element* element) {
+			return std::any_of(layout_boundaries.begin(), layout_boundaries.end(),
+				[element](const ObserverPtr<Element>& layout_boundary) { return layout_boundary.get() == element; });
+		};
+
+		for (const ObserverPtr<Element>& layout_boundary_ptr : layout_boundaries)
+		{
+			Element* layout_boundary = layout_boundary_ptr.get();
+			if (!layout_boundary || layout_boundary->GetOwnerDocument() != this)
+				continue;
+
+			// Skip any boundaries contained within another dirty boundary, they will be formatted along with their ancestor.
+			bool ancestor_dirty = false;
+			for (Element* ancestor = layout_boundary->GetParentNode(); ancestor && ancestor != this && !ancestor_dirty;
+				 ancestor = ancestor->GetParentNode())
+				ancestor_dirty = IsDirtyLayoutBoundary(ancestor);
+
+			if (ancestor_dirty)
+				continue;
+
+			if (!LayoutEngine::FormatLayoutBoundary(layout_boundary))
+			{
+				// The layout could not be contained within the boundary, format the whole document instead.
+				layout_dirty = true;
+				UpdateLayout();
+				return;
+			}
+		}
+
+		layout_dirty = false;
+		dirty_layout_boundaries.clear();
 	}
 }
 
@@ -583,9 +626,21 @@ void ElementDocument::DirtyPosition()
 
 void ElementDocument::DirtyLayout()
 {
+	GetLayoutCache()->Clear();
 	layout_dirty = true;
 }
 
+void ElementDocument::DirtyLayoutBoundary(Element* layout_boundary)
+{
+	RMLUI_ASSERT(layout_boundary && layout_boundary != this);
+	for (const ObserverPtr<Element>& dirty_layout_boundary : dirty_layout_boundaries)
+	{
+		if (dirty_layout_boundary.get() == layout_boundary)
+			return;
+	}
+	dirty_layout_boundaries.push_back(layout_boundary->GetObserverPtr());
+}
+
 bool ElementDocument::IsLayoutDirty()
 {
 	return layout_dirty;
@@ -171,11 +171,30 @@ void ElementStyle::UpdateDefinition()
 {
 	RMLUI_ZoneScoped;
 
+	ancestor_filter = AncestorFilter();
+	if (Element* parent = element->GetParentNode())
+	{
+		const ElementStyle* parent_style = parent->GetStyle();
+		ancestor_filter = parent_style->ancestor_filter;
+		ancestor_filter.AddElement(parent->GetTagName(), parent->GetId(), parent_style->classes);
+	}
+
 	SharedPtr<const ElementDefinition> new_definition;
 
+	definition_shareable = false;
+
 	if (const StyleSheet* style_sheet = element->GetStyleSheet())
 	{
-		new_definition = style_sheet->GetElementDefinition(element);
+		// Skip matching entirely if we can reuse the definition of a sibling, common for e.g. rows in a list.
+		if (const SharedPtr<const ElementDefinition>* shared_definition = FindSharedDefinition())
+		{
+			new_definition = *shared_definition;
+			definition_shareable = true;
+		}
+		else
+		{
+			new_definition = style_sheet->GetElementDefinition(element, &definition_shareable);
+		}
 	}
 
 	// Switch the property definitions if the definition has changed.
@@ -212,6 +231,52 @@ void ElementStyle::UpdateDefinition()
 	}
 }
 
+const AncestorFilter& ElementStyle::GetAncestorFilter() const
+{
+	return ancestor_filter;
+}
+
+void ElementStyle::SetChildIndexHint(int index)
+{
+	child_index_hint = index;
+}
+
+const SharedPtr<const ElementDefinition>* ElementStyle::FindSharedDefinition() const
+{
+	Element* parent = element->GetParentNode();
+	if (!parent || child_index_hint < 1)
+		return nullptr;
+
+	// Look for the closest preceding sibling that is not a text element. The hint may be outdated, but any sibling will do.
+	Element* sibling = nullptr;
+	for (int i = child_index_hint - 1; i >= 0 && i >= child_index_hint - 2; i--)
+	{
+		Element* candidate = parent->GetChild(i);
+		if (candidate && candidate != element && candidate->GetTagName() != "#text")
+		{
+			sibling = candidate;
+			break;
+		}
+	}
+
+	if (!sibling || sibling->dirty_definition)
+		return nullptr;
+
+	const ElementStyle* sibling_style = sibling->GetStyle();
+	if (!sibling_style->definition_shareable || sibling->GetTagName() != element->GetTagName() || sibling->GetId() != element->GetId() ||
+		sibling_style->classes != classes || sibling_style->pseudo_classes.size() != pseudo_classes.size())
+		return nullptr;
+
+	for (const auto& pseudo_class : pseudo_classes)
+	{
+		auto it = sibling_style->pseudo_classes.find(pseudo_class.first);
+		if (it == sibling_style->pseudo_classes.end() || it->second != pseudo_class.second)
+			return nullptr;
+	}
+
+	return &sibling_style->definition;
+}
+
 bool ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate, bool override_class)
 {
 	bool changed = false;
@@ -441,6 +506,7 @@ float ElementStyle::ResolveRelativeLength(NumericValue value, RelativeTarget rel
 void ElementStyle::DirtyInheritedProperties()
 {
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyPropertiesWithUnits(Units units)
@@ -499,11 +565,13 @@ PropertiesIterator ElementStyle::Iterate() const
 void ElementStyle::DirtyProperty(PropertyId id)
 {
 	dirty_properties.Insert(id);
+	element->DirtyUpdate();
 }
 
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
 	dirty_properties |= properties;
+	element->DirtyUpdate();
 }
 
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values,
@@ -924,6 +992,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		{
 			auto child = element->GetChild(i);
 			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+			child->DirtyUpdate();
 		}
 	}
 
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
 
 namespace Rml {
 
@@ -56,6 +57,10 @@ public:
 
 	/// Update this definition if required
 	void UpdateDefinition();
+	/// Returns the filter of names of this element's ancestors, updated together with the definition.
+	const AncestorFilter& GetAncestorFilter() const;
+	/// Sets the expected index of this element within its parent, used to find a sibling to share the definition with.
+	void SetChildIndexHint(int index);
 
 	/// Sets or removes a pseudo-class on the element.
 	/// @param[in] pseudo_class The pseudo class to activate or deactivate.
@@ -150,6 +155,9 @@ private:
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary& inline_properties, const ElementDefinition* definition);
 	static const Property* GetProperty(PropertyId id, const Element* element, const PropertyDictionary& inline_properties,
 		const ElementDefinition* definition);
+	// Returns the definition of a sibling whose definition can be shared with this element, or null if none was found.
+	const SharedPtr<const ElementDefinition>* FindSharedDefinition() const;
+
 	static void TransitionPropertyChanges(Element* element, PropertyIdSet& properties, const PropertyDictionary& inline_properties,
 		const ElementDefinition* old_definition, const ElementDefinition* new_definition);
 
@@ -165,6 +173,13 @@ private:
 	PropertyDictionary inline_properties;
 	// The definition of this element, provides applicable properties from the stylesheet.
 	SharedPtr<const ElementDefinition> definition;
+	// The names of our ancestors, refreshed whenever the definition is updated. A name change in an ancestor only dirties its descendants when
+	// the name is used on an ancestor in some selector, so the filter may be stale for other names. It is only complete for names which can
+	// affect selector matching, and must not be relied upon otherwise.
+	AncestorFilter ancestor_filter;
+	// True if the definition only depends on the tag, id, classes, pseudo classes, and ancestors of the element.
+	bool definition_shareable = false;
+	int child_index_hint = -1;
 
 	PropertyIdSet dirty_properties;
 };
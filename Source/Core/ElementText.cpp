@@ -41,6 +41,7 @@
 #include "ComputeProperty.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "TextGeometryCache.h"
 #include "TransformState.h"
 
 namespace Rml {
@@ -170,10 +171,28 @@ void ElementText::OnRender()
 		}
 	}
 
-	if (render)
+	if (render && text_geometry)
 	{
-		for (size_t i = 0; i < geometry.size(); ++i)
-			geometry[i].geometry.Render(translation, geometry[i].texture);
+		for (const TextGeometry::TexturedGeometry& geometry : text_geometry->geometry)
+			geometry.geometry.Render(translation, geometry.texture);
+
+		if (!text_geometry->glyph_instances.empty())
+		{
+			const ColourbPremultiplied alpha_colour(colour.alpha, colour.alpha);
+			const ColourbPremultiplied opacity_colour = Colourb(255).ToPremultiplied(opacity);
+
+			for (const TextGeometry::TexturedGlyphInstanceGeometry& instances : text_geometry->glyph_instances)
+			{
+				ColourbPremultiplied tint_colour = colour;
+				switch (instances.tint)
+				{
+				case GlyphTint::Colour: tint_colour = colour; break;
+				case GlyphTint::Alpha: tint_colour = alpha_colour; break;
+				case GlyphTint::Opacity: tint_colour = opacity_colour; break;
+				}
+				instances.geometry.Render(translation, instances.texture, tint_colour);
+			}
+		}
 	}
 
 	if (decoration)
@@ -247,35 +266,53 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 			{
 				if (word_break == WordBreak::BreakAll || (word_break == WordBreak::BreakWord && line.empty()))
 				{
-					// Try to break up the word
+					// Try to break up the word.
 					max_token_width = int(maximum_line_width - line_width);
-					const int token_max_size = int(next_token_begin - token_begin);
-					bool force_loop_break_after_next = false;
+					const char* token_end = next_token_begin;
 
-					// @performance: Can be made much faster. Use string width heuristics and logarithmic search.
-					for (int i = token_max_size - 1; i > 0; --i)
-					{
+					auto MeasurePartialToken = [&](const char* partial_string_end) {
 						token.clear();
 						next_token_begin = token_begin;
-						const char* partial_string_end = StringUtilities::SeekBackwardUTF8(token_begin + i, token_begin);
 						BuildToken(token, next_token_begin, partial_string_end, line.empty() && trim_whitespace_prefix, collapse_white_space,
 							break_at_endline, text_transform_property, decode_escape_characters);
-						token_width = font_engine_interface->GetStringWidth(font_face_handle, token, text_shaping_context, previous_codepoint);
-
-						if (force_loop_break_after_next || token_width <= max_token_width)
-						{
-							break;
-						}
-						else if (next_token_begin == token_begin)
-						{
-							// This means the first character of the token doesn't fit. Let it overflow into the next line if we can.
-							if (allow_empty || !line.empty())
-								return false;
-
-							// Not even the first character of the line fits. Go back to consume the first character even though it will overflow.
-							i += 2;
-							force_loop_break_after_next = true;
-						}
+						return font_engine_interface->GetStringWidth(font_face_handle, token, text_shaping_context, previous_codepoint);
+					};
+
+					// The token can be broken before any of its characters except the first one.
+					Vector<const char*> break_positions;
+					for (const char* p = token_begin + 1; p < token_end; ++p)
+					{
+						if ((*p & 0xC0) != 0x80)
+							break_positions.push_back(p);
+					}
+
+					// Binary search for the last break position where the first part of the token still fits on the line.
+					int num_fitting_positions = 0;
+					int upper_bound = (int)break_positions.size();
+					while (num_fitting_positions < upper_bound)
+					{
+						const int i = (num_fitting_positions + upper_bound) / 2;
+						if (MeasurePartialToken(break_positions[i]) <= max_token_width)
+							num_fitting_positions = i + 1;
+						else
+							upper_bound = i;
+					}
+
+					if (num_fitting_positions > 0)
+					{
+						token_width = MeasurePartialToken(break_positions[num_fitting_positions - 1]);
+					}
+					else
+					{
+						// This means the first character of the token doesn't fit. Let it overflow into the next line if we can.
+						if (allow_empty || !line.empty())
+							return false;
+
+						// Nothing else is on the line, consume the first character even though it will overflow.
+						if (!break_positions.empty())
+							token_width = MeasurePartialToken(break_positions[0]);
+						else
+							next_token_begin = token_end;
 					}
 
 					break_line = true;
@@ -306,7 +343,8 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 
 void ElementText::ClearLines()
 {
-	geometry.clear();
+	// Keep the geometry until it is generated again, it can be reused if the new lines are equal to the current ones.
+	geometry_dirty = true;
 	lines.clear();
 	generated_decoration = Style::TextDecoration::None;
 }
@@ -352,7 +390,8 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 		{
 			opacity = new_opacity;
 			font_effects_dirty = true;
-			geometry_dirty = true;
+			if (!text_geometry || !text_geometry->key.glyph_instancing)
+				geometry_dirty = true;
 		}
 	}
 
@@ -366,7 +405,7 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	{
 		font_face_changed = true;
 
-		geometry.clear();
+		text_geometry.reset();
 		geometry_dirty = true;
 
 		font_effects_handle = 0;
@@ -394,8 +433,9 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	}
 	else if (colour_changed)
 	{
-		// Force the geometry to be regenerated.
-		geometry_dirty = true;
+		// Force the geometry to be regenerated, unless we render glyph instances which are coloured while rendering.
+		if (!text_geometry || !text_geometry->key.glyph_instancing)
+			geometry_dirty = true;
 
 		// Re-colour the decoration geometry.
 		if (decoration)
@@ -454,28 +494,162 @@ void ElementText::GenerateGeometry(RenderManager& render_manager, const FontFace
 	const auto& computed = GetComputedValues();
 	const TextShapingContext text_shaping_context{computed.language(), computed.direction(), computed.letter_spacing()};
 
+	generated_decoration = Style::TextDecoration::None;
+	geometry_dirty = false;
+
+	TextGeometryKey key;
+	key.render_manager = &render_manager;
+	key.font_face_handle = font_face_handle;
+	key.font_effects_handle = font_effects_handle;
+	key.font_handle_version = font_handle_version;
+	key.language = text_shaping_context.language;
+	key.direction = text_shaping_context.text_direction;
+	key.letter_spacing = text_shaping_context.letter_spacing;
+	key.lines.reserve(lines.size());
+	for (const Line& line : lines)
+		key.lines.push_back(TextGeometryLine{line.text, line.position});
+
+	// Prefer glyph instances when supported by both the render interface and the font engine. They are coloured while rendering, thus the colour
+	// is only part of the key when rendering regular geometry.
+	const bool try_glyph_instancing = render_manager.IsGlyphInstancingSupported();
+	key.glyph_instancing = try_glyph_instancing;
+	if (!key.glyph_instancing)
+	{
+		key.colour = colour;
+		key.opacity = opacity;
+	}
+
+	auto ApplyLineWidths = [this]() {
+		for (size_t i = 0; i < lines.size(); i++)
+			lines[i].width = text_geometry->line_widths[i];
+	};
+
+	// Reuse the current geometry if nothing has changed, such as after laying out the same lines again, otherwise look for geometry generated by
+	// other text elements.
+	SharedPtr<TextGeometry> found_geometry;
+	if (text_geometry && text_geometry->key == key)
+		found_geometry = text_geometry;
+	else
+		found_geometry = TextGeometryCache::Find(key);
+
+	if (!found_geometry && try_glyph_instancing)
+	{
+		// The font engine may not support glyph instances, in which case we may find regular geometry instead.
+		key.glyph_instancing = false;
+		key.colour = colour;
+		key.opacity = opacity;
+		found_geometry = TextGeometryCache::Find(key);
+	}
+
+	if (found_geometry)
+	{
+		text_geometry = std::move(found_geometry);
+		ApplyLineWidths();
+		return;
+	}
+
+	// Reuse the buffers of the current geometry if it is not shared with other elements.
+	SharedPtr<TextGeometry> previous_geometry = std::move(text_geometry);
+	if (previous_geometry && previous_geometry.use_count() > 1)
+		previous_geometry.reset();
+
+	key.glyph_instancing = try_glyph_instancing;
+	if (key.glyph_instancing)
+	{
+		key.colour = {};
+		key.opacity = 0.f;
+	}
+
+	auto new_geometry = MakeShared<TextGeometry>(std::move(key));
+	if (!new_geometry->key.glyph_instancing ||
+		!GenerateGlyphInstances(render_manager, font_face_handle, text_shaping_context, *new_geometry, previous_geometry.get()))
+	{
+		new_geometry->key.glyph_instancing = false;
+		new_geometry->key.colour = colour;
+		new_geometry->key.opacity = opacity;
+		GenerateMeshes(render_manager, font_face_handle, text_shaping_context, *new_geometry, previous_geometry.get());
+	}
+
+	previous_geometry.reset();
+	TextGeometryCache::Insert(new_geometry);
+	text_geometry = std::move(new_geometry);
+	ApplyLineWidths();
+}
+
+void ElementText::GenerateMeshes(RenderManager& render_manager, const FontFaceHandle font_face_handle,
+	const TextShapingContext& text_shaping_context, TextGeometry& new_geometry, TextGeometry* previous_geometry)
+{
 	// Release the old geometry, and reuse the mesh buffers.
-	TexturedMeshList mesh_list(geometry.size());
-	for (size_t i = 0; i < geometry.size(); i++)
-		mesh_list[i].mesh = geometry[i].geometry.Release(Geometry::ReleaseMode::ClearMesh);
+	TexturedMeshList mesh_list;
+	if (previous_geometry)
+	{
+		mesh_list.resize(previous_geometry->geometry.size());
+		for (size_t i = 0; i < previous_geometry->geometry.size(); i++)
+			mesh_list[i].mesh = previous_geometry->geometry[i].geometry.Release(Geometry::ReleaseMode::ClearMesh);
+	}
 
 	// Generate the new geometry, one line at a time.
+	new_geometry.line_widths.resize(lines.size());
 	for (size_t i = 0; i < lines.size(); ++i)
 	{
-		lines[i].width = GetFontEngineInterface()->GenerateString(render_manager, font_face_handle, font_effects_handle, lines[i].text,
+		new_geometry.line_widths[i] = GetFontEngineInterface()->GenerateString(render_manager, font_face_handle, font_effects_handle, lines[i].text,
 			lines[i].position, colour, opacity, text_shaping_context, mesh_list);
 	}
 
-	// Apply the new geometry and textures.
-	geometry.resize(mesh_list.size());
-	for (size_t i = 0; i < geometry.size(); i++)
+	// Apply the new geometry and textures, skipping any empty meshes.
+	new_geometry.geometry.reserve(mesh_list.size());
+	for (TexturedMesh& textured_mesh : mesh_list)
 	{
-		geometry[i].geometry = render_manager.MakeGeometry(std::move(mesh_list[i].mesh));
-		geometry[i].texture = mesh_list[i].texture;
+		if (textured_mesh.mesh.indices.empty())
+			continue;
+
+		new_geometry.geometry.emplace_back();
+		new_geometry.geometry.back().geometry = render_manager.MakeGeometry(std::move(textured_mesh.mesh));
+		new_geometry.geometry.back().texture = textured_mesh.texture;
 	}
+}
 
-	generated_decoration = Style::TextDecoration::None;
-	geometry_dirty = false;
+bool ElementText::GenerateGlyphInstances(RenderManager& render_manager, const FontFaceHandle font_face_handle,
+	const TextShapingContext& text_shaping_context, TextGeometry& new_geometry, TextGeometry* previous_geometry)
+{
+	// Release the old instances, and reuse their buffers.
+	TexturedGlyphInstancesList instance_list;
+	if (previous_geometry)
+	{
+		instance_list.resize(previous_geometry->glyph_instances.size());
+		for (size_t i = 0; i < previous_geometry->glyph_instances.size(); i++)
+		{
+			instance_list[i].instances = previous_geometry->glyph_instances[i].geometry.Release();
+			instance_list[i].instances.clear();
+		}
+	}
+
+	// Generate the new instances, one line at a time.
+	new_geometry.line_widths.resize(lines.size());
+	for (size_t i = 0; i < lines.size(); ++i)
+	{
+		const int width = GetFontEngineInterface()->GenerateStringInstances(render_manager, font_face_handle, font_effects_handle, lines[i].text,
+			lines[i].position, text_shaping_context, instance_list);
+		if (width < 0)
+			return false;
+
+		new_geometry.line_widths[i] = width;
+	}
+
+	// Apply the new instances and textures, skipping any empty lists.
+	new_geometry.glyph_instances.reserve(instance_list.size());
+	for (TexturedGlyphInstances& textured_instances : instance_list)
+	{
+		if (textured_instances.instances.empty())
+			continue;
+
+		new_geometry.glyph_instances.emplace_back();
+		new_geometry.glyph_instances.back().geometry = render_manager.MakeGlyphInstanceGeometry(std::move(textured_instances.instances));
+		new_geometry.glyph_instances.back().texture = textured_instances.texture;
+		new_geometry.glyph_instances.back().tint = textured_instances.tint;
+	}
+
+	return true;
 }
 
 void ElementText::GenerateDecoration(Mesh& mesh, const FontFaceHandle font_face_handle)
@@ -38,6 +38,7 @@
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/RenderManager.h"
 #include "../../Include/RmlUi/Core/TextShapingContext.h"
+#include "ClipRegionCache.h"
 #include "DataController.h"
 #include "DataModel.h"
 #include "DataView.h"
@@ -273,8 +274,18 @@ bool ElementUtilities::SetClippingRegion(Element* element, bool force_clip_self)
 
 	Rectanglei clip_region;
 	ClipMaskGeometryList clip_mask_list;
+	bool scissoring_enabled = false;
+
+	// Reuse the clipping region from the previous render if nothing has changed since. Clip masks reference geometry that
+	// may be regenerated, so regions using them are never retained.
+	ClipRegionCache* clip_region_cache = (force_clip_self ? nullptr : element->GetClipRegionCache());
+	if (!clip_region_cache || !clip_region_cache->Get(scissoring_enabled, clip_region))
+	{
+		scissoring_enabled = GetClippingRegion(element, clip_region, &clip_mask_list, force_clip_self);
+		if (clip_region_cache && clip_mask_list.empty())
+			clip_region_cache->Set(scissoring_enabled, clip_region);
+	}
 
-	const bool scissoring_enabled = GetClippingRegion(element, clip_region, &clip_mask_list, force_clip_self);
 	if (scissoring_enabled)
 		render_manager.SetScissorRegion(clip_region);
 	else
@@ -461,9 +472,13 @@ static bool ApplyDataViewsControllersInternal(Element* element, const bool const
 
 				ViewControllerInitializer initializer;
 
-				// Structural data views are applied in a separate step from the normal views and controllers.
+				// Structural data views are applied in a separate step from the normal views and controllers. Any attributes with a modifier
+				// are options to the structural view, such as 'data-for-key'.
 				if (construct_structural_view)
 				{
+					if (type_end != String::npos)
+						continue;
+
 					if (DataViewPtr view = Factory::InstanceDataView(type_name, element, true))
 					{
 						initializer.modifier_or_inner_rml = structural_view_inner_rml;
@@ -90,6 +90,8 @@ void ElementFormControlInput::SetCompositionRange(int range_start, int range_end
 void ElementFormControlInput::OnUpdate()
 {
 	RMLUI_ASSERT(type);
+	// The input type needs to be updated during every update loop.
+	DirtyUpdate();
 	type->OnUpdate();
 }
 
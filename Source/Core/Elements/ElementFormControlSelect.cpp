@@ -114,6 +114,9 @@ void ElementFormControlSelect::OnUpdate()
 {
 	ElementFormControl::OnUpdate();
 
+	// The widget needs to be updated during every update loop.
+	DirtyUpdate();
+
 	MoveChildren();
 
 	widget->OnUpdate();
@@ -131,6 +131,8 @@ bool ElementFormControlTextArea::GetIntrinsicDimensions(Vector2f& dimensions, fl
 
 void ElementFormControlTextArea::OnUpdate()
 {
+	// The widget needs to be updated during every update loop.
+	DirtyUpdate();
 	widget->OnUpdate();
 }
 
@@ -66,4 +66,11 @@ bool FileInterface::LoadFile(const String& path, String& out_data)
 	return true;
 }
 
+Span<const byte> FileInterface::MapFile(FileHandle /*file*/)
+{
+	return {};
+}
+
+void FileInterface::UnmapFile(Span<const byte> /*data*/) {}
+
 } // namespace Rml
@@ -30,6 +30,15 @@
 
 #ifndef RMLUI_NO_FILE_INTERFACE_DEFAULT
 
+	#if defined(RMLUI_PLATFORM_WIN32)
+		#include <io.h>
+		#include <windows.h>
+	#elif defined(RMLUI_PLATFORM_UNIX) && !defined(RMLUI_PLATFORM_EMSCRIPTEN)
+		#include <sys/mman.h>
+		#include <sys/stat.h>
+		#define RMLUI_FILE_INTERFACE_MMAP
+	#endif
+
 namespace Rml {
 
 FileInterfaceDefault::~FileInterfaceDefault() {}
@@ -59,5 +68,57 @@ size_t FileInterfaceDefault::Tell(FileHandle file)
 	return ftell((FILE*)file);
 }
 
+Span<const byte> FileInterfaceDefault::MapFile(FileHandle file)
+{
+	#if defined(RMLUI_PLATFORM_WIN32)
+	HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno((FILE*)file));
+	if (file_handle == INVALID_HANDLE_VALUE)
+		return {};
+
+	LARGE_INTEGER file_size = {};
+	if (!GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart <= 0)
+		return {};
+
+	HANDLE mapping = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+		return {};
+
+	// The view keeps the mapping alive after its handle is closed.
+	void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!data)
+		return {};
+
+	return {static_cast<const byte*>(data), (size_t)file_size.QuadPart};
+	#elif defined(RMLUI_FILE_INTERFACE_MMAP)
+	const int file_descriptor = fileno((FILE*)file);
+
+	struct stat file_status = {};
+	if (fstat(file_descriptor, &file_status) != 0 || file_status.st_size <= 0)
+		return {};
+
+	// The mapping remains valid after the file is closed.
+	void* data = mmap(nullptr, (size_t)file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+	if (data == MAP_FAILED)
+		return {};
+
+	return {static_cast<const byte*>(data), (size_t)file_status.st_size};
+	#else
+	(void)file;
+	return {};
+	#endif
+}
+
+void FileInterfaceDefault::UnmapFile(Span<const byte> data)
+{
+	#if defined(RMLUI_PLATFORM_WIN32)
+	UnmapViewOfFile(data.data());
+	#elif defined(RMLUI_FILE_INTERFACE_MMAP)
+	munmap(const_cast<byte*>(data.data()), data.size());
+	#else
+	(void)data;
+	#endif
+}
+
 } // namespace Rml
 #endif /*RMLUI_NO_FILE_INTERFACE_DEFAULT*/
@@ -70,6 +70,14 @@ public:
 	/// @param file The handle of the file to be queried.
 	/// @return The number of bytes from the origin of the file.
 	size_t Tell(FileHandle file) override;
+
+	/// Maps the contents of a file into memory, using the memory mapping facilities of the operating system.
+	/// @param file The handle of the file to map.
+	/// @return The mapped contents of the file, or an empty span if the file could not be mapped.
+	Span<const byte> MapFile(FileHandle file) override;
+	/// Releases memory previously mapped through MapFile().
+	/// @param data The mapped contents of the file.
+	void UnmapFile(Span<const byte> data) override;
 };
 
 } // namespace Rml
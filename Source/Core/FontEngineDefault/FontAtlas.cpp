@@ -0,0 +1,215 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontAtlas.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include "FontFaceHandleDefault.h"
+#include <string.h>
+
+namespace Rml {
+
+// The dimensions of the first page, each new page doubles in size up to the maximum size.
+static constexpr int min_page_size = 256;
+static constexpr int max_page_size = 1024;
+static constexpr int max_num_pages = 8;
+
+static_assert(max_num_pages >= 3, "The atlas must allow for at least one page of maximum size.");
+
+// Glyphs are placed with one pixel of padding to avoid filtering artifacts.
+static bool Fits(Vector2i dimensions, int page_size)
+{
+	return dimensions.x + 2 <= page_size && dimensions.y + 2 <= page_size;
+}
+
+FontAtlas::FontAtlas() {}
+
+FontAtlas::~FontAtlas() {}
+
+bool FontAtlas::Allocate(FontFaceHandleDefault* owner, Vector2i dimensions, Allocation& allocation)
+{
+	if (!FitsOnPage(dimensions))
+		return false;
+
+	TextureLayoutRectangle rectangle(0, dimensions);
+
+	int page_index = -1;
+	for (int i = 0; i < (int)pages.size(); i++)
+	{
+		if (pages[i]->layout.Place(rectangle, i))
+		{
+			page_index = i;
+			break;
+		}
+	}
+
+	if (page_index < 0)
+	{
+		page_index = AddOrEvictPage(dimensions);
+		if (page_index < 0)
+			return false;
+
+		const bool placed = pages[page_index]->layout.Place(rectangle, page_index);
+		RMLUI_ASSERT(placed);
+		(void)placed;
+	}
+
+	Page& page = *pages[page_index];
+	page.owners[owner] += 1;
+	MarkPageUsed(page);
+
+	const Vector2i page_dimensions = page.layout.GetDimensions();
+	const Vector2i position = rectangle.GetPosition();
+
+	allocation.page_index = page_index;
+	allocation.texcoords[0] = Vector2f(position) / Vector2f(page_dimensions);
+	allocation.texcoords[1] = Vector2f(position + dimensions) / Vector2f(page_dimensions);
+	allocation.stride = page_dimensions.x * 4;
+	allocation.data = page.data.data() + position.y * allocation.stride + position.x * 4;
+
+	page.texture.Invalidate();
+
+	return true;
+}
+
+void FontAtlas::Release(FontFaceHandleDefault* owner)
+{
+	for (auto& page : pages)
+	{
+		auto it = page->owners.find(owner);
+		if (it == page->owners.end())
+			continue;
+
+		page->owners.erase(it);
+
+		// Reclaim the space of the page once it no longer holds any glyphs.
+		if (page->owners.empty())
+			ResetPage(*page);
+	}
+}
+
+void FontAtlas::ReleaseUnusedPages()
+{
+	while (!pages.empty() && pages.back()->owners.empty())
+		pages.pop_back();
+}
+
+void FontAtlas::MarkPagesUsed(FontFaceHandleDefault* owner)
+{
+	for (auto& page : pages)
+	{
+		if (page->owners.find(owner) != page->owners.end())
+			MarkPageUsed(*page);
+	}
+}
+
+void FontAtlas::BeginFrame()
+{
+	frame += 1;
+}
+
+int FontAtlas::GetNumPages() const
+{
+	return (int)pages.size();
+}
+
+int FontAtlas::GetMaxNumPages()
+{
+	return max_num_pages;
+}
+
+bool FontAtlas::FitsOnPage(Vector2i dimensions)
+{
+	return Fits(dimensions, max_page_size);
+}
+
+Texture FontAtlas::GetTexture(RenderManager& render_manager, int page_index) const
+{
+	RMLUI_ASSERT(page_index >= 0 && page_index < (int)pages.size());
+	return pages[page_index]->texture.GetTexture(render_manager);
+}
+
+int FontAtlas::AddOrEvictPage(Vector2i dimensions)
+{
+	if ((int)pages.size() < max_num_pages)
+	{
+		int page_size = Math::Min(min_page_size << (int)pages.size(), max_page_size);
+		while (!Fits(dimensions, page_size))
+			page_size *= 2;
+
+		const int page_index = (int)pages.size();
+		pages.push_back(MakeUnique<Page>());
+
+		Page& page = *pages.back();
+		page.layout = TextureLayoutTexture(Vector2i(page_size));
+		page.data.resize(page_size * page_size * 4, 0);
+		page.texture = CallbackTextureSource([this, page_index](const CallbackTextureInterface& texture_interface) -> bool {
+			const Page& page = *pages[page_index];
+			return texture_interface.GenerateTexture(page.data, page.layout.GetDimensions());
+		});
+
+		return page_index;
+	}
+
+	// Evict the least recently used page that is large enough for the glyph. Pages used during the current frame may still be referenced by text
+	// geometry that has been rendered, or by the string being generated.
+	int page_index = -1;
+	for (int i = 0; i < (int)pages.size(); i++)
+	{
+		const Page& page = *pages[i];
+		if (page.last_used_frame != frame && Fits(dimensions, page.layout.GetDimensions().x) &&
+			(page_index < 0 || page.last_used < pages[page_index]->last_used))
+			page_index = i;
+	}
+	if (page_index < 0)
+		return -1;
+
+	Page& page = *pages[page_index];
+	const auto owners = std::move(page.owners);
+	page.owners.clear();
+	ResetPage(page);
+
+	for (const auto& owner : owners)
+		owner.first->OnAtlasPageEvicted(page_index);
+
+	return page_index;
+}
+
+void FontAtlas::MarkPageUsed(Page& page)
+{
+	page.last_used = ++use_counter;
+	page.last_used_frame = frame;
+}
+
+void FontAtlas::ResetPage(Page& page)
+{
+	page.layout = TextureLayoutTexture(page.layout.GetDimensions());
+	memset(page.data.data(), 0, page.data.size());
+	page.texture.Invalidate();
+}
+
+} // namespace Rml
@@ -0,0 +1,122 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTATLAS_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTATLAS_H
+
+#include "../../../Include/RmlUi/Core/CallbackTexture.h"
+#include "../../../Include/RmlUi/Core/Texture.h"
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include "../TextureLayoutTexture.h"
+
+namespace Rml {
+
+class FontFaceHandleDefault;
+
+/**
+    A texture atlas shared by the glyphs of all font face handles, including all their sizes and effect layers.
+
+    Glyphs are packed into a few large pages, thereby saving texture memory and allowing text of different font faces to be rendered from the same
+    texture. When all the pages are full, the least recently used page is evicted. Each handle with glyphs on the evicted page is notified, so that
+    it can regenerate the affected glyphs and text geometry.
+
+    Pages used during the current frame are never evicted, as text rendered from them may already have been submitted. Instead, the allocation
+    fails, and the glyph should be placed again during a later frame. The frame is advanced whenever a context is rendered, thus when rendering
+    multiple contexts, a context may evict the pages used by contexts rendered before it.
+ */
+
+class FontAtlas : NonCopyMoveable {
+public:
+	FontAtlas();
+	~FontAtlas();
+
+	struct Allocation {
+		// The page the glyph is placed on.
+		int page_index = -1;
+		// The texture coordinates of the allocated area.
+		Vector2f texcoords[2];
+		// The destination for the glyph's pixel data in 8-bit RGBA (premultiplied) format, and the stride of the data in bytes.
+		byte* data = nullptr;
+		int stride = 0;
+	};
+
+	/// Allocates an area of the atlas for a glyph. The texture of the page is regenerated on next use, thus the glyph should be written to the
+	/// returned data right away.
+	/// @param[in] owner The handle owning the glyph, which will be notified if the glyph is evicted.
+	/// @param[in] dimensions The dimensions of the glyph.
+	/// @param[out] allocation The allocated area.
+	/// @return True on success, false if the glyph is too large to fit on any page, or all pages it fits on are in use during the current frame.
+	bool Allocate(FontFaceHandleDefault* owner, Vector2i dimensions, Allocation& allocation);
+
+	/// Releases all glyphs allocated by the given handle. Pages are reset once all their glyphs have been released.
+	void Release(FontFaceHandleDefault* owner);
+
+	/// Releases trailing pages without any glyphs, along with their textures.
+	void ReleaseUnusedPages();
+
+	/// Marks all pages with glyphs of the given handle as used during the current frame, preventing them from being evicted until a later frame.
+	void MarkPagesUsed(FontFaceHandleDefault* owner);
+
+	/// Starts a new frame, after which pages used during previous frames may be evicted again.
+	void BeginFrame();
+
+	/// Returns the number of pages in the atlas. New pages are only ever added to the end, so page indices remain stable.
+	int GetNumPages() const;
+	/// Returns the maximum number of pages in the atlas, all page indices are below this number.
+	static int GetMaxNumPages();
+	/// Returns true if a glyph of the given dimensions fits on a page of maximum size, otherwise it can never be allocated.
+	static bool FitsOnPage(Vector2i dimensions);
+
+	/// Returns the texture of the given page.
+	Texture GetTexture(RenderManager& render_manager, int page_index) const;
+
+private:
+	struct Page {
+		TextureLayoutTexture layout;
+		Vector<byte> data;
+		CallbackTextureSource texture;
+		// The number of glyphs allocated on this page by each handle.
+		SmallUnorderedMap<FontFaceHandleDefault*, int> owners;
+		uint64_t last_used = 0;
+		uint64_t last_used_frame = 0;
+	};
+
+	// Adds a new page if we have not reached the maximum number of pages, otherwise evicts and returns the least recently used page that is not in
+	// use during the current frame. Returns -1 if no such page can be found.
+	int AddOrEvictPage(Vector2i dimensions);
+	void MarkPageUsed(Page& page);
+	void ResetPage(Page& page);
+
+	Vector<UniquePtr<Page>> pages;
+	uint64_t use_counter = 0;
+	uint64_t frame = 0;
+};
+
+} // namespace Rml
+#endif
@@ -88,9 +88,21 @@ int FontEngineInterfaceDefault::GenerateString(RenderManager& render_manager, Fo
 		(int)font_effects_handle);
 }
 
+int FontEngineInterfaceDefault::GenerateStringInstances(RenderManager& render_manager, FontFaceHandle handle, FontEffectsHandle font_effects_handle,
+	StringView string, Vector2f position, const TextShapingContext& text_shaping_context, TexturedGlyphInstancesList& instance_list)
+{
+	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+	return handle_default->GenerateStringInstances(render_manager, instance_list, string, position, text_shaping_context.letter_spacing,
+		(int)font_effects_handle);
+}
+
 int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
 {
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
+
+	// The version is queried right before rendering text generated from the handle, thus its glyphs are in use during this frame.
+	FontProvider::GetFontAtlas().MarkPagesUsed(handle_default);
+
 	return handle_default->GetVersion();
 }
 
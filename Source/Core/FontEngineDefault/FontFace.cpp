@@ -28,16 +28,30 @@
 
 #include "FontFace.h"
 #include "../../../Include/RmlUi/Core/Log.h"
+#include "../../../Include/RmlUi/Core/Profiling.h"
+#include "FontFaceDistanceField.h"
 #include "FontFaceHandleDefault.h"
+#include "FontFaceKerning.h"
 #include "FreeTypeInterface.h"
 
 namespace Rml {
 
-FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style::FontWeight _weight)
+FontFace::FontFace(FontFaceHandleFreetype _face, Style::FontStyle _style, Style::FontWeight _weight, bool _distance_field)
 {
 	style = _style;
 	weight = _weight;
 	face = _face;
+
+	InitializeFace(_distance_field);
+}
+
+FontFace::FontFace(Span<const byte> data, const String& source, int named_instance_index, Style::FontStyle _style, Style::FontWeight _weight,
+	bool _distance_field) :
+	lazy_data(data), lazy_source(source), lazy_named_instance_index(named_instance_index), lazy_distance_field(_distance_field)
+{
+	style = _style;
+	weight = _weight;
+	face = 0;
 }
 
 FontFace::~FontFace()
@@ -62,6 +76,9 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 	if (it != handles.end())
 		return it->second.get();
 
+	if (!face && !lazy_data.empty() && !LoadLazyFace())
+		return nullptr;
+
 	// See if this face has been released.
 	if (!face)
 	{
@@ -71,7 +88,7 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 
 	// Construct and initialise the new handle.
 	auto handle = MakeUnique<FontFaceHandleDefault>();
-	if (!handle->Initialize(face, size, load_default_glyphs))
+	if (!handle->Initialize(face, size, load_default_glyphs, distance_field.get(), kerning.get()))
 	{
 		handles[size] = nullptr;
 		return nullptr;
@@ -85,9 +102,39 @@ FontFaceHandleDefault* FontFace::GetHandle(int size, bool load_default_glyphs)
 	return result;
 }
 
+bool FontFace::LoadLazyFace()
+{
+	RMLUI_ZoneScoped;
+
+	face = FreeType::LoadFace(lazy_data, lazy_source, lazy_named_instance_index);
+	lazy_data = {};
+
+	if (!face)
+		return false;
+
+	InitializeFace(lazy_distance_field);
+
+	return true;
+}
+
+void FontFace::InitializeFace(bool use_distance_field)
+{
+	if (use_distance_field)
+		distance_field = MakeUnique<FontFaceDistanceField>(face);
+
+	if (FreeType::HasKerning(face))
+		kerning = MakeUnique<FontFaceKerning>(face);
+}
+
 void FontFace::ReleaseFontResources()
 {
 	HandleMap().swap(handles);
+
+	if (distance_field)
+		distance_field->ReleaseGlyphs();
+
+	if (kerning)
+		kerning->ReleasePairs();
 }
 
 } // namespace Rml
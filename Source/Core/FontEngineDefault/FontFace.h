@@ -34,7 +34,9 @@
 
 namespace Rml {
 
+class FontFaceDistanceField;
 class FontFaceHandleDefault;
+class FontFaceKerning;
 
 /**
     @author Peter Curry
@@ -42,7 +44,13 @@ class FontFaceHandleDefault;
 
 class FontFace {
 public:
-	FontFace(FontFaceHandleFreetype face, Style::FontStyle style, Style::FontWeight weight);
+	FontFace(FontFaceHandleFreetype face, Style::FontStyle style, Style::FontWeight weight, bool distance_field);
+	/// Constructs a face which is loaded from memory only when its first handle is requested.
+	/// @param[in] data The font file in memory, must remain valid for the lifetime of the face.
+	/// @param[in] source The source of the font file, only used for logging.
+	/// @param[in] named_instance_index The named instance of the face to load, or zero for the default instance.
+	FontFace(Span<const byte> data, const String& source, int named_instance_index, Style::FontStyle style, Style::FontWeight weight,
+		bool distance_field);
 	~FontFace();
 
 	Style::FontStyle GetStyle() const;
@@ -58,6 +66,11 @@ public:
 	void ReleaseFontResources();
 
 private:
+	// Loads a face which was constructed to be loaded on first use.
+	bool LoadLazyFace();
+	// Creates the shared state of the handles, once the face has been loaded.
+	void InitializeFace(bool use_distance_field);
+
 	Style::FontStyle style;
 	Style::FontWeight weight;
 
@@ -65,7 +78,19 @@ private:
 	using HandleMap = UnorderedMap<int, UniquePtr<FontFaceHandleDefault>>;
 	HandleMap handles;
 
+	// The distance fields to generate glyphs from, or nullptr if glyphs are rasterized directly for every size.
+	UniquePtr<FontFaceDistanceField> distance_field;
+
+	// The kerning pairs shared by all handles, or nullptr if the face has no kerning.
+	UniquePtr<FontFaceKerning> kerning;
+
 	FontFaceHandleFreetype face;
+
+	// The font data and parameters to load the face from on first use, the data is empty once loaded.
+	Span<const byte> lazy_data;
+	String lazy_source;
+	int lazy_named_instance_index = 0;
+	bool lazy_distance_field = false;
 };
 
 } // namespace Rml
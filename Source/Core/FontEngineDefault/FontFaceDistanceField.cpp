@@ -0,0 +1,243 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontFaceDistanceField.h"
+#include "../../../Include/RmlUi/Core/Math.h"
+#include "FreeTypeInterface.h"
+
+namespace Rml {
+
+// The font size at which glyph outlines are rasterized to generate their distance fields.
+static constexpr int reference_size = 64;
+// The distance, in pixels at the reference size, covered by the distance fields on either side of the outline.
+static constexpr int spread = 8;
+
+static constexpr float infinity = 1e20f;
+
+// Computes the squared Euclidean distance transform of a one-dimensional grid, using the algorithm of Felzenszwalb and Huttenlocher.
+static void DistanceTransform1D(float* grid, const int offset, const int stride, const int length, float* f, float* z, int* v)
+{
+	v[0] = 0;
+	z[0] = -infinity;
+	z[1] = infinity;
+	f[0] = grid[offset];
+
+	// Find the lower envelope of the parabolas rooted at each grid cell.
+	for (int q = 1, k = 0; q < length; q++)
+	{
+		f[q] = grid[offset + q * stride];
+
+		float s = 0.f;
+		do
+		{
+			const int r = v[k];
+			s = (f[q] - f[r] + float(q * q - r * r)) / float(q - r) * 0.5f;
+		} while (s <= z[k] && --k > -1);
+
+		k++;
+		v[k] = q;
+		z[k] = s;
+		z[k + 1] = infinity;
+	}
+
+	// Sample the lower envelope.
+	for (int q = 0, k = 0; q < length; q++)
+	{
+		while (z[k + 1] < float(q))
+			k++;
+
+		const int r = v[k];
+		grid[offset + q * stride] = f[r] + float((q - r) * (q - r));
+	}
+}
+
+static void DistanceTransform2D(Vector<float>& grid, const Vector2i dimensions)
+{
+	const int max_length = Math::Max(dimensions.x, dimensions.y);
+	Vector<float> f(max_length);
+	Vector<float> z(max_length + 1);
+	Vector<int> v(max_length);
+
+	for (int x = 0; x < dimensions.x; x++)
+		DistanceTransform1D(grid.data(), x, dimensions.x, dimensions.y, f.data(), z.data(), v.data());
+
+	for (int y = 0; y < dimensions.y; y++)
+		DistanceTransform1D(grid.data(), y * dimensions.x, 1, dimensions.x, f.data(), z.data(), v.data());
+}
+
+// Encodes a signed distance, positive outside the outline, into a byte where the outline is located at the middle value.
+static byte EncodeDistance(float distance)
+{
+	return byte(Math::Clamp(Math::Round(128.f - distance * (127.f / float(spread))), 0.f, 255.f));
+}
+
+static float DecodeDistance(float value)
+{
+	return (128.f - value) * (float(spread) / 127.f);
+}
+
+FontFaceDistanceField::FontFaceDistanceField(FontFaceHandleFreetype _face) : face(_face) {}
+
+FontFaceDistanceField::~FontFaceDistanceField() {}
+
+bool FontFaceDistanceField::AppendGlyph(int font_size, Character character, FontGlyphMap& glyphs)
+{
+	RMLUI_ASSERT(glyphs.find(character) == glyphs.end());
+
+	const FieldGlyph& field_glyph = GetFieldGlyph(character, font_size);
+	if (!field_glyph.valid)
+		return false;
+
+	const float scale = float(font_size) / float(reference_size);
+
+	FontGlyph glyph;
+	glyph.dimensions = Vector2i((Vector2f(field_glyph.dimensions) * scale).Round());
+	glyph.advance = int(Math::Round(float(field_glyph.advance) * scale));
+
+	if (field_glyph.bitmap_dimensions.x > 0 && field_glyph.bitmap_dimensions.y > 0)
+	{
+		// The bounds of the outline bitmap at the new size, with the y-axis pointing downwards from the baseline.
+		const Vector2f reference_top_left = Vector2f(float(field_glyph.bearing.x), float(-field_glyph.bearing.y));
+		const Vector2f reference_bottom_right = reference_top_left + Vector2f(field_glyph.bitmap_dimensions);
+		const Vector2i top_left = Vector2i(int(Math::RoundDown(reference_top_left.x * scale)), int(Math::RoundDown(reference_top_left.y * scale)));
+		const Vector2i bottom_right =
+			Vector2i(int(Math::RoundUp(reference_bottom_right.x * scale)), int(Math::RoundUp(reference_bottom_right.y * scale)));
+
+		glyph.bearing = Vector2i(top_left.x, -top_left.y);
+		glyph.bitmap_dimensions = bottom_right - top_left;
+		glyph.color_format = ColorFormat::A8;
+		glyph.bitmap_owned_data.reset(new byte[glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y]);
+		glyph.bitmap_data = glyph.bitmap_owned_data.get();
+
+		// The position of the first field sample, in the same coordinates as above, at the reference size.
+		const Vector2f field_origin = reference_top_left - Vector2f(float(spread)) + Vector2f(0.5f);
+		const Vector2i field_dimensions = field_glyph.field_dimensions;
+		const byte* field = field_glyph.field.data();
+
+		auto SampleField = [&](int x, int y) -> float {
+			if (x < 0 || y < 0 || x >= field_dimensions.x || y >= field_dimensions.y)
+				return 0.f;
+			return float(field[y * field_dimensions.x + x]);
+		};
+
+		for (int y = 0; y < glyph.bitmap_dimensions.y; y++)
+		{
+			for (int x = 0; x < glyph.bitmap_dimensions.x; x++)
+			{
+				// Bilinearly sample the distance field at the pixel center.
+				const Vector2f position = (Vector2f(float(top_left.x + x), float(top_left.y + y)) + Vector2f(0.5f)) / scale - field_origin;
+				const Vector2f position_floor = Vector2f(Math::RoundDown(position.x), Math::RoundDown(position.y));
+				const Vector2f t = position - position_floor;
+				const int fx = int(position_floor.x);
+				const int fy = int(position_floor.y);
+
+				const float top = Math::Lerp(t.x, SampleField(fx, fy), SampleField(fx + 1, fy));
+				const float bottom = Math::Lerp(t.x, SampleField(fx, fy + 1), SampleField(fx + 1, fy + 1));
+				const float distance = DecodeDistance(Math::Lerp(t.y, top, bottom)) * scale;
+
+				// Antialias the outline over one pixel at the new size.
+				const float coverage = Math::Clamp(0.5f - distance, 0.f, 1.f);
+				glyph.bitmap_owned_data[y * glyph.bitmap_dimensions.x + x] = byte(Math::Round(coverage * 255.f));
+			}
+		}
+	}
+
+	glyphs.emplace(character, std::move(glyph));
+
+	return true;
+}
+
+void FontFaceDistanceField::ReleaseGlyphs()
+{
+	field_glyphs.clear();
+}
+
+const FontFaceDistanceField::FieldGlyph& FontFaceDistanceField::GetFieldGlyph(Character character, int font_size)
+{
+	auto it = field_glyphs.find(character);
+	if (it != field_glyphs.end())
+		return it->second;
+
+	FieldGlyph& field_glyph = field_glyphs[character];
+
+	FontGlyph outline;
+	if (!FreeType::RenderGlyphOutline(face, reference_size, font_size, character, outline))
+		return field_glyph;
+
+	field_glyph.valid = true;
+	field_glyph.dimensions = outline.dimensions;
+	field_glyph.bearing = outline.bearing;
+	field_glyph.advance = outline.advance;
+	field_glyph.bitmap_dimensions = outline.bitmap_dimensions;
+
+	if (outline.bitmap_dimensions.x == 0 || outline.bitmap_dimensions.y == 0)
+		return field_glyph;
+
+	const Vector2i dimensions = outline.bitmap_dimensions + Vector2i(2 * spread);
+	const int num_pixels = dimensions.x * dimensions.y;
+
+	// Squared distances to the nearest pixel inside the outline, and to the nearest pixel outside the outline. Partially covered pixels are
+	// treated as lying at a distance to the outline given by their coverage.
+	Vector<float> outer(num_pixels, infinity);
+	Vector<float> inner(num_pixels, 0.f);
+
+	for (int y = 0; y < outline.bitmap_dimensions.y; y++)
+	{
+		for (int x = 0; x < outline.bitmap_dimensions.x; x++)
+		{
+			const float coverage = float(outline.bitmap_data[y * outline.bitmap_dimensions.x + x]) / 255.f;
+			if (coverage <= 0.f)
+				continue;
+
+			const int i = (y + spread) * dimensions.x + x + spread;
+			if (coverage >= 1.f)
+			{
+				outer[i] = 0.f;
+				inner[i] = infinity;
+			}
+			else
+			{
+				const float distance = 0.5f - coverage;
+				outer[i] = (distance > 0.f ? distance * distance : 0.f);
+				inner[i] = (distance < 0.f ? distance * distance : 0.f);
+			}
+		}
+	}
+
+	DistanceTransform2D(outer, dimensions);
+	DistanceTransform2D(inner, dimensions);
+
+	field_glyph.field.resize(num_pixels);
+	field_glyph.field_dimensions = dimensions;
+	for (int i = 0; i < num_pixels; i++)
+		field_glyph.field[i] = EncodeDistance(Math::SquareRoot(outer[i]) - Math::SquareRoot(inner[i]));
+
+	return field_glyph;
+}
+
+} // namespace Rml
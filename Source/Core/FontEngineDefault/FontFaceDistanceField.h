@@ -0,0 +1,87 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEDISTANCEFIELD_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEDISTANCEFIELD_H
+
+#include "../../../Include/RmlUi/Core/FontGlyph.h"
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "FontTypes.h"
+
+namespace Rml {
+
+/**
+    Signed distance fields of the glyphs in a font face, used to generate the glyphs of all font sizes.
+
+    The outline of each glyph is only rasterized once, at a fixed reference size, and converted to a distance field. Glyph bitmaps for any font
+    size are then produced by resampling the distance field, which is much cheaper than rasterizing the outline again for every new size.
+ */
+
+class FontFaceDistanceField : NonCopyMoveable {
+public:
+	FontFaceDistanceField(FontFaceHandleFreetype face);
+	~FontFaceDistanceField();
+
+	/// Builds the glyph of a character at the given font size from its distance field, and adds it to 'glyphs'.
+	/// @param[in] font_size The font size of the glyph, in pixels.
+	/// @param[in] character The character to build the glyph for.
+	/// @param[in,out] glyphs The glyph map to add the glyph to.
+	/// @return False if the character has no scalable outline, in which case its glyph should be rasterized directly instead.
+	bool AppendGlyph(int font_size, Character character, FontGlyphMap& glyphs);
+
+	/// Releases the distance fields of all glyphs.
+	void ReleaseGlyphs();
+
+private:
+	struct FieldGlyph {
+		// False if the glyph can not be generated from a distance field.
+		bool valid = false;
+
+		// The glyph metrics at the reference size.
+		Vector2i dimensions;
+		Vector2i bearing;
+		int advance = 0;
+
+		// The outline bitmap the distance field was generated from.
+		Vector2i bitmap_dimensions;
+
+		// The signed distance field of the outline bitmap, with an added border on all sides.
+		Vector<byte> field;
+		Vector2i field_dimensions;
+	};
+
+	// Returns the distance field glyph of the given character, generating it if necessary.
+	const FieldGlyph& GetFieldGlyph(Character character, int font_size);
+
+	UnorderedMap<Character, FieldGlyph> field_glyphs;
+
+	FontFaceHandleFreetype face;
+};
+
+} // namespace Rml
+#endif
@@ -29,17 +29,36 @@
 #include "FontFaceHandleDefault.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
-#include "../TextureLayout.h"
+#include "../../../Include/RmlUi/Core/Utilities.h"
+#include "FontAtlas.h"
+#include "FontFaceDistanceField.h"
+#include "FontFaceKerning.h"
 #include "FontFaceLayer.h"
 #include "FontProvider.h"
 #include "FreeTypeInterface.h"
 #include <algorithm>
-#include <numeric>
 
 namespace Rml {
 
-static constexpr char32_t KerningCache_AsciiSubsetBegin = 32;
-static constexpr char32_t KerningCache_AsciiSubsetLast = 126;
+
+// Longer strings are not cached, they are most likely whole lines or paragraphs rather than words.
+static constexpr size_t StringWidthCache_MaxStringLength = 64;
+static constexpr size_t StringWidthCache_GenerationSize = 2048;
+
+static size_t HashStringWidthKey(StringView string, float letter_spacing, Character prior_character)
+{
+	// FNV-1a hash of the string.
+	size_t hash = 2166136261u;
+	for (char c : string)
+	{
+		hash ^= size_t(static_cast<unsigned char>(c));
+		hash *= 16777619u;
+	}
+
+	Utilities::HashCombine(hash, letter_spacing);
+	Utilities::HashCombine(hash, char32_t(prior_character));
+	return hash;
+}
 
 FontFaceHandleDefault::FontFaceHandleDefault()
 {
@@ -50,21 +69,34 @@ FontFaceHandleDefault::FontFaceHandleDefault()
 
 FontFaceHandleDefault::~FontFaceHandleDefault()
 {
+	FontProvider::GetFontAtlas().Release(this);
 	glyphs.clear();
 	layers.clear();
 }
 
-bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs)
+bool FontFaceHandleDefault::Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, FontFaceDistanceField* _distance_field,
+	FontFaceKerning* _kerning)
 {
 	ft_face = face;
+	distance_field = _distance_field;
+	kerning = _kerning;
 
 	RMLUI_ASSERTMSG(layer_configurations.empty(), "Initialize must only be called once.");
 
-	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, load_default_glyphs))
+	// When using distance fields, the default glyphs are generated from them below instead of being rasterized by FreeType.
+	if (!FreeType::InitialiseFaceHandle(ft_face, font_size, glyphs, metrics, kerning_scale, load_default_glyphs && !distance_field))
 		return false;
 
-	has_kerning = FreeType::HasKerning(ft_face);
-	FillKerningPairCache();
+	if (load_default_glyphs && distance_field)
+	{
+		for (char32_t character = 32; character <= 126; ++character)
+		{
+			if (glyphs.find(Character(character)) == glyphs.end())
+				AppendGlyph(Character(character));
+		}
+	}
+
+	UpdateGlyphTable();
 
 	// Generate the default layer and layer configuration.
 	base_layer = GetOrCreateLayer(nullptr);
@@ -87,7 +119,54 @@ int FontFaceHandleDefault::GetStringWidth(StringView string, float letter_spacin
 {
 	RMLUI_ZoneScoped;
 
-	bool has_set_size = false;
+	if (string.size() > StringWidthCache_MaxStringLength)
+		return MeasureStringWidth(string, letter_spacing, prior_character);
+
+	auto Matches = [&](const StringWidthEntry& entry) {
+		return entry.letter_spacing == letter_spacing && entry.prior_character == prior_character && StringView(entry.string) == string;
+	};
+
+	const int fallback_version = FontProvider::GetFallbackFontFacesVersion();
+	if (fallback_version != string_width_fallback_version)
+	{
+		string_width_cache.clear();
+		previous_string_width_cache.clear();
+		string_width_fallback_version = fallback_version;
+	}
+
+	const size_t hash = HashStringWidthKey(string, letter_spacing, prior_character);
+
+	auto it = string_width_cache.find(hash);
+	if (it != string_width_cache.end() && Matches(it->second))
+		return it->second.width;
+
+	StringWidthEntry entry;
+	auto it_previous = previous_string_width_cache.find(hash);
+	if (it_previous != previous_string_width_cache.end() && Matches(it_previous->second))
+	{
+		// Move the string to the current generation.
+		entry = std::move(it_previous->second);
+		previous_string_width_cache.erase(it_previous);
+	}
+	else
+	{
+		entry = StringWidthEntry{String(string), letter_spacing, prior_character, MeasureStringWidth(string, letter_spacing, prior_character)};
+	}
+
+	const int width = entry.width;
+
+	if (string_width_cache.size() >= StringWidthCache_GenerationSize)
+	{
+		previous_string_width_cache = std::move(string_width_cache);
+		string_width_cache.clear();
+	}
+	string_width_cache[hash] = std::move(entry);
+
+	return width;
+}
+
+int FontFaceHandleDefault::MeasureStringWidth(StringView string, float letter_spacing, Character prior_character)
+{
 	int width = 0;
 	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 	{
@@ -98,7 +177,7 @@ int FontFaceHandleDefault::GetStringWidth(StringView string, float letter_spacin
 			continue;
 
 		// Adjust the cursor for the kerning between this character and the previous one.
-		width += GetKerning(prior_character, character, has_set_size);
+		width += GetKerning(prior_character, character);
 
 		// Adjust the cursor for this character's advance.
 		width += glyph->advance;
@@ -173,73 +252,82 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 	return (int)(layer_configurations.size() - 1);
 }
 
-bool FontFaceHandleDefault::GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect,
-	int texture_id, int handle_version) const
+static void ReserveGlyphs(TexturedMesh& textured_mesh, size_t num_glyphs)
 {
-	if (handle_version != version)
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
-		return false;
-	}
+	textured_mesh.mesh.vertices.reserve(textured_mesh.mesh.vertices.size() + num_glyphs * 4);
+	textured_mesh.mesh.indices.reserve(textured_mesh.mesh.indices.size() + num_glyphs * 6);
+}
 
-	auto it = std::find_if(layers.begin(), layers.end(), [font_effect](const EffectLayerPair& pair) { return pair.font_effect == font_effect; });
+static void ReserveGlyphs(TexturedGlyphInstances& textured_instances, size_t num_glyphs)
+{
+	textured_instances.instances.reserve(textured_instances.instances.size() + num_glyphs);
+}
 
-	if (it == layers.end())
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Layer id not found.");
-		return false;
-	}
+static bool IsEmpty(const TexturedMesh& textured_mesh)
+{
+	return textured_mesh.mesh.indices.empty();
+}
 
-	return it->layer->GenerateTexture(texture_data, texture_dimensions, texture_id, glyphs);
+static bool IsEmpty(const TexturedGlyphInstances& textured_instances)
+{
+	return textured_instances.instances.empty();
 }
 
-int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, const Vector2f position,
+template <typename TexturedList>
+int FontFaceHandleDefault::GenerateStringLists(RenderManager& render_manager, Vector<TexturedList>& list, StringView string, const Vector2f position,
 	const ColourbPremultiplied colour, const float opacity, const float letter_spacing, const int layer_configuration_index)
 {
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int)layer_configurations.size());
 
-	int geometry_index = 0;
 	int line_width = 0;
-	bool has_set_size = false;
 
-	UpdateLayersOnDirty();
+	FontAtlas& atlas = FontProvider::GetFontAtlas();
+
+	// Prevent the pages holding our glyphs from being evicted while placing new glyphs, as we may already have generated geometry from them.
+	atlas.MarkPagesUsed(this);
 
 	// Fetch the requested configuration and generate the geometry for each one.
 	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
 
-	// Each texture represents one geometry.
-	const int num_geometries = std::accumulate(layer_configuration.begin(), layer_configuration.end(), 0,
-		[](int sum, const FontFaceLayer* layer) { return sum + layer->GetNumTextures(); });
+	// Each layer is given one geometry for every page of the font atlas, ordered by layer and then by page. The base layer is followed by an
+	// additional set of geometry for glyphs with their own colours. Geometry of unused pages is left empty. Using a fixed number of pages per layer
+	// keeps the geometry indices stable even if new pages are added while generating the string.
+	const int max_num_pages = FontAtlas::GetMaxNumPages();
+	const int num_geometries = ((int)layer_configuration.size() + 1) * max_num_pages;
+
+	list.resize(num_geometries);
 
-	mesh_list.resize(num_geometries);
+	// Reserve room for every character on each existing page, most strings are rendered from a single page.
+	const int num_existing_pages = atlas.GetNumPages();
+	for (int i = 0; i < num_geometries; i++)
+	{
+		if (i % max_num_pages < num_existing_pages)
+			ReserveGlyphs(list[i], string.size());
+	}
 
-	for (size_t layer_index = 0; layer_index < layer_configuration.size(); ++layer_index)
+	int geometry_offset = 0;
+	for (FontFaceLayer* layer : layer_configuration)
 	{
-		FontFaceLayer* layer = layer_configuration[layer_index];
+		TexturedList* layer_lists = &list[geometry_offset];
+		TexturedList* color_glyph_lists = layer_lists;
+		geometry_offset += max_num_pages;
 
 		ColourbPremultiplied layer_colour;
 		if (layer == base_layer)
+		{
 			layer_colour = colour;
+			color_glyph_lists = &list[geometry_offset];
+			geometry_offset += max_num_pages;
+		}
 		else
+		{
 			layer_colour = layer->GetColour(opacity);
-
-		const int num_textures = layer->GetNumTextures();
-		if (num_textures == 0)
-			continue;
-
-		RMLUI_ASSERT(geometry_index + num_textures <= (int)mesh_list.size());
+		}
 
 		line_width = 0;
 		Character prior_character = Character::Null;
 
-		// Set the mesh and textures to the geometries.
-		for (int tex_index = 0; tex_index < num_textures; ++tex_index)
-			mesh_list[geometry_index + tex_index].texture = layer->GetTexture(render_manager, tex_index);
-
-		mesh_list[geometry_index].mesh.indices.reserve(string.size() * 6);
-		mesh_list[geometry_index].mesh.vertices.reserve(string.size() * 4);
-
 		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 		{
 			Character character = *it_string;
@@ -249,48 +337,78 @@ int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, Texture
 				continue;
 
 			// Adjust the cursor for the kerning between this character and the previous one.
-			line_width += GetKerning(prior_character, character, has_set_size);
+			line_width += GetKerning(prior_character, character);
 
+			TexturedList* glyph_lists = layer_lists;
 			ColourbPremultiplied glyph_color = layer_colour;
 			// Use white vertex colors on RGB glyphs.
 			if (layer == base_layer && glyph->color_format == ColorFormat::RGBA8)
+			{
+				glyph_lists = color_glyph_lists;
 				glyph_color = ColourbPremultiplied(layer_colour.alpha, layer_colour.alpha);
+			}
 
-			layer->GenerateGeometry(&mesh_list[geometry_index], character, Vector2f(position.x + line_width, position.y), glyph_color);
+			const Vector2f glyph_position(position.x + line_width, position.y);
+			if (!layer->GenerateGeometry(glyph_lists, max_num_pages, character, glyph_position, glyph_color))
+			{
+				// The glyph has been evicted from the font atlas, place it again. If the atlas is full for now, change the version so that
+				// the geometry is generated again during the next frame.
+				AppendGlyphToLayers(character, *glyph);
+				if (!layer->GenerateGeometry(glyph_lists, max_num_pages, character, glyph_position, glyph_color))
+					++version;
+			}
 
 			line_width += glyph->advance;
 			line_width += (int)letter_spacing;
 			prior_character = character;
 		}
+	}
 
-		geometry_index += num_textures;
+	// Set the textures of the pages in use.
+	const int num_pages = atlas.GetNumPages();
+	for (int i = 0; i < num_geometries; i++)
+	{
+		const int page_index = i % max_num_pages;
+		if (page_index < num_pages && !IsEmpty(list[i]))
+			list[i].texture = atlas.GetTexture(render_manager, page_index);
 	}
 
 	return Math::Max(line_width, 0);
 }
 
-bool FontFaceHandleDefault::UpdateLayersOnDirty()
+int FontFaceHandleDefault::GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, const Vector2f position,
+	const ColourbPremultiplied colour, const float opacity, const float letter_spacing, const int layer_configuration_index)
 {
-	bool result = false;
+	return GenerateStringLists(render_manager, mesh_list, string, position, colour, opacity, letter_spacing, layer_configuration_index);
+}
+
+int FontFaceHandleDefault::GenerateStringInstances(RenderManager& render_manager, TexturedGlyphInstancesList& instance_list, StringView string,
+	const Vector2f position, const float letter_spacing, const int layer_configuration_index)
+{
+	// Generate the instances in white and full opacity, the colour of the text is applied according to the tint of each list.
+	const int line_width = GenerateStringLists(render_manager, instance_list, string, position, ColourbPremultiplied(255), 1.f, letter_spacing,
+		layer_configuration_index);
+
+	const LayerConfiguration& layer_configuration = layer_configurations[layer_configuration_index];
+	const int max_num_pages = FontAtlas::GetMaxNumPages();
 
-	// If we are dirty, regenerate all the layers and increment the version
-	if (is_layers_dirty && base_layer)
+	int geometry_offset = 0;
+	for (FontFaceLayer* layer : layer_configuration)
 	{
-		is_layers_dirty = false;
-		++version;
+		const bool is_base_layer = (layer == base_layer);
+		for (int i = 0; i < max_num_pages; i++)
+			instance_list[geometry_offset + i].tint = (is_base_layer ? GlyphTint::Colour : GlyphTint::Opacity);
+		geometry_offset += max_num_pages;
 
-		// Regenerate all the layers.
-		// Note: The layer regeneration needs to happen in the order in which the layers were created,
-		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
-		for (auto& pair : layers)
+		if (is_base_layer)
 		{
-			GenerateLayer(pair.layer.get());
+			for (int i = 0; i < max_num_pages; i++)
+				instance_list[geometry_offset + i].tint = GlyphTint::Alpha;
+			geometry_offset += max_num_pages;
 		}
-
-		result = true;
 	}
 
-	return result;
+	return line_width;
 }
 
 int FontFaceHandleDefault::GetVersion() const
@@ -298,64 +416,46 @@ int FontFaceHandleDefault::GetVersion() const
 	return version;
 }
 
+void FontFaceHandleDefault::OnAtlasPageEvicted(int page_index)
+{
+	for (auto& pair : layers)
+		pair.layer->RemoveGlyphsOnPage(page_index);
+
+	// Any geometry generated from the evicted glyphs is now invalid.
+	++version;
+}
+
 bool FontFaceHandleDefault::AppendGlyph(Character character)
 {
+	if (distance_field && distance_field->AppendGlyph(metrics.size, character, glyphs))
+		return true;
+
 	bool result = FreeType::AppendGlyph(ft_face, metrics.size, character, glyphs);
 	return result;
 }
 
-void FontFaceHandleDefault::FillKerningPairCache()
+void FontFaceHandleDefault::UpdateGlyphTable()
 {
-	if (!has_kerning)
-		return;
-
-	for (char32_t i = KerningCache_AsciiSubsetBegin; i <= KerningCache_AsciiSubsetLast; i++)
+	for (char32_t i = 0; i < FontGlyphTableSize; i++)
 	{
-		for (char32_t j = KerningCache_AsciiSubsetBegin; j <= KerningCache_AsciiSubsetLast; j++)
-		{
-			const bool first_iteration = (i == KerningCache_AsciiSubsetBegin && j == KerningCache_AsciiSubsetBegin);
-
-			// Fetch the kerning from the font face. Submit zero font size on subsequent iterations for performance reasons.
-			const int kerning = FreeType::GetKerning(ft_face, first_iteration ? metrics.size : 0, Character(i), Character(j));
-			if (kerning != 0)
-			{
-				kerning_pair_cache.emplace(AsciiPair((i << 8) | j), KerningIntType(kerning));
-			}
-		}
+		auto it = glyphs.find(Character(i));
+		glyph_table[i] = (it != glyphs.end() ? &it->second : nullptr);
 	}
 }
 
-int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs, bool& has_set_size) const
+int FontFaceHandleDefault::GetKerning(Character lhs, Character rhs) const
 {
 	static_assert(' ' == 32, "Only ASCII/UTF8 character set supported.");
 
 	// Check if we have no kerning, or if we have a control character.
-	if (!has_kerning || char32_t(lhs) < ' ' || char32_t(rhs) < ' ')
+	if (!kerning || char32_t(lhs) < ' ' || char32_t(rhs) < ' ')
 		return 0;
 
-	// See if the kerning pair has been cached.
-	const bool lhs_in_cache = (char32_t(lhs) >= KerningCache_AsciiSubsetBegin && char32_t(lhs) <= KerningCache_AsciiSubsetLast);
-	const bool rhs_in_cache = (char32_t(rhs) >= KerningCache_AsciiSubsetBegin && char32_t(rhs) <= KerningCache_AsciiSubsetLast);
-
-	if (lhs_in_cache && rhs_in_cache)
-	{
-		const auto it = kerning_pair_cache.find(AsciiPair((int(lhs) << 8) | int(rhs)));
-
-		if (it != kerning_pair_cache.end())
-		{
-			return it->second;
-		}
-
+	const int unscaled_kerning = kerning->GetUnscaledKerning(lhs, rhs);
+	if (unscaled_kerning == 0)
 		return 0;
-	}
-
-	// Fetch it from the font face instead.
-	const int result = FreeType::GetKerning(ft_face, has_set_size ? 0 : metrics.size, lhs, rhs);
-
-	// This is purely an optimization to avoid repeatedly setting the font size in FreeType, which can be a measurable performance hit.
-	has_set_size = true;
 
-	return result;
+	return FreeType::ScaleKerning(kerning_scale, unscaled_kerning);
 }
 
 const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts)
@@ -364,6 +464,9 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 	if ((char32_t)character < (char32_t)' ')
 		return nullptr;
 
+	if ((char32_t)character < FontGlyphTableSize && glyph_table[(char32_t)character])
+		return glyph_table[(char32_t)character];
+
 	auto it_glyph = glyphs.find(character);
 	if (it_glyph == glyphs.end())
 	{
@@ -371,6 +474,8 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 
 		if (result)
 		{
+			UpdateGlyphTable();
+
 			it_glyph = glyphs.find(character);
 			if (it_glyph == glyphs.end())
 			{
@@ -378,7 +483,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				return nullptr;
 			}
 
-			is_layers_dirty = true;
+			AppendGlyphToLayers(character, it_glyph->second);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -396,7 +501,10 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if (pair.second)
-						is_layers_dirty = true;
+					{
+						UpdateGlyphTable();
+						AppendGlyphToLayers(character, it_glyph->second);
+					}
 					break;
 				}
 			}
@@ -420,6 +528,13 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 	return glyph;
 }
 
+void FontFaceHandleDefault::AppendGlyphToLayers(Character character, const FontGlyph& glyph)
+{
+	// Add the glyph to the layers in the order they were created, so that any cloned layer has already been given the glyph.
+	for (auto& pair : layers)
+		pair.layer->AppendGlyph(character, glyph);
+}
+
 FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect)
 {
 	// Search for the font effect layer first, it may have been instanced before as part of a different configuration.
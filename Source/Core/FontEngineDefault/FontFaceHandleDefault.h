@@ -36,9 +36,12 @@
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "../../../Include/RmlUi/Core/Traits.h"
 #include "FontTypes.h"
+#include "FreeTypeInterface.h"
 
 namespace Rml {
 
+class FontFaceDistanceField;
+class FontFaceKerning;
 class FontFaceLayer;
 
 /**
@@ -50,7 +53,8 @@ public:
 	FontFaceHandleDefault();
 	~FontFaceHandleDefault();
 
-	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs);
+	bool Initialize(FontFaceHandleFreetype face, int font_size, bool load_default_glyphs, FontFaceDistanceField* distance_field = nullptr,
+		FontFaceKerning* kerning = nullptr);
 
 	const FontMetrics& GetFontMetrics() const;
 
@@ -67,15 +71,6 @@ public:
 	/// @param[in] font_effects The list of font effects to generate the configuration for.
 	/// @return The index to use when generating geometry using this configuration.
 	int GenerateLayerConfiguration(const FontEffectList& font_effects);
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] font_effect The font effect used for the layer.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] handle_version The version of the handle data. Function returns false if out of date.
-	bool GenerateLayerTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id,
-		int handle_version) const;
-
 	/// Generates the geometry required to render a single line of text.
 	/// @param[in] render_manager The render manager responsible for rendering the string.
 	/// @param[out] mesh_list A list to place the new meshes into.
@@ -88,19 +83,42 @@ public:
 	/// @return The width, in pixels, of the string geometry.
 	int GenerateString(RenderManager& render_manager, TexturedMeshList& mesh_list, StringView string, Vector2f position, ColourbPremultiplied colour,
 		float opacity, float letter_spacing, int layer_configuration);
+	/// Generates the glyph instances required to render a single line of text. The instances are tinted according to their lists when rendered.
+	/// @param[in] render_manager The render manager responsible for rendering the string.
+	/// @param[out] instance_list A list to place the new glyph instances into.
+	/// @param[in] string The string to render.
+	/// @param[in] position The position of the baseline of the first character to render.
+	/// @param[in] letter_spacing The letter spacing size in pixels.
+	/// @param[in] layer_configuration Face configuration index to use for generating string.
+	/// @return The width, in pixels, of the string.
+	int GenerateStringInstances(RenderManager& render_manager, TexturedGlyphInstancesList& instance_list, StringView string, Vector2f position,
+		float letter_spacing, int layer_configuration);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
+	/// Version is changed whenever glyphs are evicted from the font atlas, requiring regeneration of string geometry. Appending new glyphs to the
+	/// layers does not change the version.
 	int GetVersion() const;
 
+	/// Called by the font atlas when one of its pages has been evicted, the glyphs on the page will be placed again as they are used.
+	/// @param[in] page_index The index of the evicted page.
+	void OnAtlasPageEvicted(int page_index);
+
 private:
 	// Build and append glyph to 'glyphs'
 	bool AppendGlyph(Character character);
 
-	// Build a kerning cache for common characters.
-	void FillKerningPairCache();
+	// Generates the meshes or glyph instances of a string, shared between the above generate functions.
+	template <typename TexturedList>
+	int GenerateStringLists(RenderManager& render_manager, Vector<TexturedList>& list, StringView string, Vector2f position,
+		ColourbPremultiplied colour, float opacity, float letter_spacing, int layer_configuration_index);
+
+	// Measure the width of a string, without looking it up in the string width cache.
+	int MeasureStringWidth(StringView string, float letter_spacing, Character prior_character);
+
+	// Point the glyph table to the glyphs of the characters it covers, must be called after adding glyphs.
+	void UpdateGlyphTable();
 
 	// Return the kerning for a character pair.
-	int GetKerning(Character lhs, Character rhs, bool& has_set_size) const;
+	int GetKerning(Character lhs, Character rhs) const;
 
 	/// Retrieve a glyph from the given code point, building and appending a new glyph if not already built.
 	/// @param[in-out] character  The character, can be changed e.g. to the replacement character if no glyph is found.
@@ -108,8 +126,8 @@ private:
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
-	bool UpdateLayersOnDirty();
+	// Add a new glyph to the existing layers, placing it in the font atlas.
+	void AppendGlyphToLayers(Character character, const FontGlyph& glyph);
 
 	// Create a new layer from the given font effect if it does not already exist.
 	FontFaceLayer* GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect);
@@ -118,6 +136,8 @@ private:
 	bool GenerateLayer(FontFaceLayer* layer);
 
 	FontGlyphMap glyphs;
+	// Direct lookup of the glyphs of the first characters, or nullptr where there is no glyph yet.
+	const FontGlyph* glyph_table[FontGlyphTableSize] = {};
 
 	struct EffectLayerPair {
 		const FontEffect* font_effect;
@@ -134,14 +154,26 @@ private:
 	// Each font layer that generated geometry or textures, indexed by the font-effect's fingerprint key.
 	FontLayerCache layer_cache;
 
-	// Pre-cache kerning pairs for some ascii subset of all characters.
-	using AsciiPair = uint16_t;
-	using KerningIntType = int16_t;
-	using KerningPairs = UnorderedMap<AsciiPair, KerningIntType>;
-	KerningPairs kerning_pair_cache;
-
-	bool has_kerning = false;
-	bool is_layers_dirty = false;
+	// The kerning pairs of the font face in font units, or nullptr if the face has no kerning.
+	FontFaceKerning* kerning = nullptr;
+	// Scales the kerning pairs to this font size.
+	FreeType::KerningScale kerning_scale;
+
+	// Cache of the widths of recently measured strings, such as the words measured again and again whenever text is reflowed.
+	struct StringWidthEntry {
+		String string;
+		float letter_spacing;
+		Character prior_character;
+		int width;
+	};
+	using StringWidthCache = UnorderedMap<size_t, StringWidthEntry>;
+
+	// Strings are added to the current cache generation, and looked up in both generations. When the current generation is full, it replaces
+	// the previous one, thereby evicting all the strings that have not been used during the last generation.
+	StringWidthCache string_width_cache;
+	StringWidthCache previous_string_width_cache;
+	// Both generations are cleared when fallback font faces are added, as they may provide glyphs previously measured as missing.
+	int string_width_fallback_version = 0;
 	int version = 0;
 
 	// All configurations currently in use on this handle. New configurations will be generated as required.
@@ -150,6 +182,7 @@ private:
 	FontMetrics metrics;
 
 	FontFaceHandleFreetype ft_face;
+	FontFaceDistanceField* distance_field = nullptr;
 };
 
 } // namespace Rml
@@ -0,0 +1,98 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontFaceKerning.h"
+#include "../../../Include/RmlUi/Core/Profiling.h"
+#include "FreeTypeInterface.h"
+
+namespace Rml {
+
+static constexpr char32_t AsciiTable_Begin = 32;
+static constexpr char32_t AsciiTable_Last = 126;
+static constexpr int AsciiTable_Size = int(AsciiTable_Last - AsciiTable_Begin + 1);
+
+FontFaceKerning::FontFaceKerning(FontFaceHandleFreetype face) : face(face) {}
+
+FontFaceKerning::~FontFaceKerning() {}
+
+int FontFaceKerning::GetUnscaledKerning(Character lhs, Character rhs)
+{
+	RMLUI_ASSERT(char32_t(lhs) >= ' ' && char32_t(rhs) >= ' ');
+
+	if (char32_t(lhs) <= AsciiTable_Last && char32_t(rhs) <= AsciiTable_Last)
+	{
+		if (!ascii_table_filled)
+			FillAsciiTable();
+
+		if (ascii_table.empty())
+			return 0;
+
+		const int index = int(char32_t(lhs) - AsciiTable_Begin) * AsciiTable_Size + int(char32_t(rhs) - AsciiTable_Begin);
+		return ascii_table[index];
+	}
+
+	const uint64_t key = (uint64_t(lhs) << 32) | uint64_t(rhs);
+	auto it = pair_cache.find(key);
+	if (it != pair_cache.end())
+		return it->second;
+
+	const int kerning = FreeType::GetUnscaledKerning(face, lhs, rhs);
+	pair_cache.emplace(key, kerning);
+	return kerning;
+}
+
+void FontFaceKerning::ReleasePairs()
+{
+	pair_cache = {};
+}
+
+void FontFaceKerning::FillAsciiTable()
+{
+	RMLUI_ZoneScoped;
+
+	ascii_table_filled = true;
+
+	bool has_nonzero_kerning = false;
+	ascii_table.resize(AsciiTable_Size * AsciiTable_Size);
+
+	for (char32_t i = AsciiTable_Begin; i <= AsciiTable_Last; i++)
+	{
+		for (char32_t j = AsciiTable_Begin; j <= AsciiTable_Last; j++)
+		{
+			const int kerning = FreeType::GetUnscaledKerning(face, Character(i), Character(j));
+			const int index = int(i - AsciiTable_Begin) * AsciiTable_Size + int(j - AsciiTable_Begin);
+			ascii_table[index] = int16_t(kerning);
+			has_nonzero_kerning |= (kerning != 0);
+		}
+	}
+
+	if (!has_nonzero_kerning)
+		Vector<int16_t>().swap(ascii_table);
+}
+
+} // namespace Rml
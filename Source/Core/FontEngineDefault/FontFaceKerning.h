@@ -0,0 +1,72 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEKERNING_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACEKERNING_H
+
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "FontTypes.h"
+
+namespace Rml {
+
+/**
+    The kerning pairs of a font face, shared by the handles of all font sizes.
+
+    Kerning is looked up in font units on first use and then cached, each handle scales the values to its own font size. The pairs of printable
+    ASCII characters are read together into a dense table the first time any of them is needed, all other pairs are cached individually.
+ */
+
+class FontFaceKerning : NonCopyMoveable {
+public:
+	FontFaceKerning(FontFaceHandleFreetype face);
+	~FontFaceKerning();
+
+	/// Returns the kerning between two characters in font units.
+	/// @note Control characters are not supported, the caller must exclude them.
+	int GetUnscaledKerning(Character lhs, Character rhs);
+
+	/// Releases the cached kerning of characters outside the ASCII table.
+	void ReleasePairs();
+
+private:
+	// Reads the kerning of all pairs in the ASCII table from the font face.
+	void FillAsciiTable();
+
+	// Kerning of printable ASCII characters, indexed by the left and then the right character. Empty if there is no kerning between any of the
+	// characters.
+	Vector<int16_t> ascii_table;
+	bool ascii_table_filled = false;
+
+	// Kerning of all other pairs, keyed by the left character in the upper bits and the right character in the lower bits.
+	UnorderedMap<uint64_t, int> pair_cache;
+
+	FontFaceHandleFreetype face;
+};
+
+} // namespace Rml
+#endif
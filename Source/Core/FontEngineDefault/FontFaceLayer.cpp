@@ -27,10 +27,13 @@
  */
 
 #include "FontFaceLayer.h"
-#include "../../../Include/RmlUi/Core/RenderManager.h"
+#include "../../../Include/RmlUi/Core/FontEffect.h"
+#include "FontAtlas.h"
 #include "FontFaceHandleDefault.h"
+#include "FontProvider.h"
+#include "FontWorkers.h"
+#include <algorithm>
 #include <string.h>
-#include <type_traits>
 
 namespace Rml {
 
@@ -43,233 +46,217 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 
 FontFaceLayer::~FontFaceLayer() {}
 
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
+bool FontFaceLayer::Generate(FontFaceHandleDefault* _handle, const FontFaceLayer* clone, bool clone_glyph_origins)
 {
-	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures_owned.clear();
-		textures_ptr = &textures_owned;
-	}
+	handle = _handle;
+	cloned_layer = clone;
+	cloned_glyph_origins = clone_glyph_origins;
+	character_boxes.clear();
 
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
 	// Generate the new layout.
 	if (clone)
 	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
-
-		// Point our textures to the cloned layer's textures.
-		textures_ptr = clone->textures_ptr;
-
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
+		// Clone the geometry and textures from the clone layer, adjusting the origins as appropriate.
+		character_boxes.reserve(clone->character_boxes.size());
+		for (auto& pair : clone->character_boxes)
 		{
-			for (auto& pair : glyphs)
-			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
-
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
-
-				TextureBox& box = it->second;
-
-				Vector2i glyph_origin = Vector2i(box.origin);
-				Vector2i glyph_dimensions = Vector2i(box.dimensions);
-
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					box.origin = Vector2f(glyph_origin);
-				else
-					box.texture_index = -1;
-			}
+			auto it = glyphs.find(pair.first);
+			if (it != glyphs.end())
+				character_boxes[pair.first] = CloneGlyph(pair.second, it->second);
 		}
 	}
 	else
 	{
-		// Initialise the texture layout for the glyphs.
+		// Place the tallest glyphs first, so that they are packed efficiently into the atlas.
+		Vector<FontGlyphMap::const_iterator> sorted_glyphs;
+		sorted_glyphs.reserve(glyphs.size());
+		for (auto it = glyphs.begin(); it != glyphs.end(); ++it)
+			sorted_glyphs.push_back(it);
+
+		std::sort(sorted_glyphs.begin(), sorted_glyphs.end(), [](const FontGlyphMap::const_iterator& lhs, const FontGlyphMap::const_iterator& rhs) {
+			return lhs->second.bitmap_dimensions.y > rhs->second.bitmap_dimensions.y;
+		});
+
 		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
+		pending_textures.reserve(glyphs.size());
+		for (const FontGlyphMap::const_iterator& it : sorted_glyphs)
 		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
+			// Glyphs that could not be placed are left out, to be appended again once they are used.
+			TextureBox box;
+			if (PlaceGlyph(it->second, box))
+				character_boxes[it->first] = box;
+		}
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+		// Now that all the glyphs have been placed, generate their textures. This is where font effects do most of their work, thus we let the
+		// worker threads help out.
+		FontProvider::GetFontWorkers().ParallelFor((int)pending_textures.size(), [this](int i) { GenerateTexture(pending_textures[i]); });
+		pending_textures.clear();
+	}
 
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
+	UpdateCharacterBoxTable();
 
-			TextureBox box;
-			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
-			box.dimensions = Vector2f(glyph_dimensions);
+	return true;
+}
 
-			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+void FontFaceLayer::AppendGlyph(Character character, const FontGlyph& glyph)
+{
+	if (character_boxes.find(character) != character_boxes.end())
+		return;
 
-			character_boxes[character] = box;
+	if (cloned_layer)
+	{
+		// The cloned layer has already been given the glyph, just copy its box.
+		auto it = cloned_layer->character_boxes.find(character);
+		if (it != cloned_layer->character_boxes.end())
+			character_boxes[character] = CloneGlyph(it->second, glyph);
+		UpdateCharacterBoxTable();
+		return;
+	}
 
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
-		}
+	// Placing the glyph may evict other glyphs from this layer, so make sure to do it before inserting the new box.
+	TextureBox box;
+	if (PlaceGlyph(glyph, box))
+		character_boxes[character] = box;
+	UpdateCharacterBoxTable();
 
-		constexpr int max_texture_dimensions = 1024;
+	for (const PendingTexture& pending_texture : pending_textures)
+		GenerateTexture(pending_texture);
+	pending_textures.clear();
+}
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+void FontFaceLayer::RemoveGlyphsOnPage(int page_index)
+{
+	for (auto it = character_boxes.begin(); it != character_boxes.end();)
+	{
+		if (it->second.texture_index == page_index)
+			it = character_boxes.erase(it);
+		else
+			++it;
+	}
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
-		}
+	// The page may be evicted while we are placing glyphs, in which case their textures must not be written to the reset page.
+	pending_textures.erase(std::remove_if(pending_textures.begin(), pending_textures.end(),
+							   [page_index](const PendingTexture& pending_texture) { return pending_texture.allocation.page_index == page_index; }),
+		pending_textures.end());
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+	UpdateCharacterBoxTable();
+}
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
-		{
-			const int texture_id = i;
-
-			CallbackTextureFunction texture_callback = [handle, effect_ptr, texture_id, handle_version](
-														   const CallbackTextureInterface& texture_interface) -> bool {
-				Vector2i dimensions;
-				Vector<byte> data;
-				if (!handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id, handle_version) || data.empty())
-					return false;
-				if (!texture_interface.GenerateTexture(data, dimensions))
-					return false;
-				return true;
-			};
-
-			static_assert(std::is_nothrow_move_constructible<CallbackTextureSource>::value,
-				"CallbackTextureSource must be nothrow move constructible so that it can be placed in the vector below.");
-
-			textures_owned.emplace_back(std::move(texture_callback));
-		}
-	}
+const FontEffect* FontFaceLayer::GetFontEffect() const
+{
+	return effect.get();
+}
 
-	return true;
+ColourbPremultiplied FontFaceLayer::GetColour(float opacity) const
+{
+	return colour.ToPremultiplied(opacity);
 }
 
-bool FontFaceLayer::GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
+void FontFaceLayer::UpdateCharacterBoxTable()
 {
-	if (texture_id < 0 || texture_id > texture_layout.GetNumTextures())
-		return false;
+	for (char32_t i = 0; i < FontGlyphTableSize; i++)
+	{
+		auto it = character_boxes.find(Character(i));
+		character_box_table[i] = (it != character_boxes.end() ? &it->second : nullptr);
+	}
+}
 
-	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
-	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+bool FontFaceLayer::PlaceGlyph(const FontGlyph& glyph, TextureBox& box)
+{
+	Vector2i glyph_origin(0, 0);
+	Vector2i glyph_dimensions = glyph.bitmap_dimensions;
 
-	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	// Adjust glyph origin / dimensions for the font effect.
+	if (effect)
 	{
-		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+			return true;
+	}
+
+	box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+	box.dimensions = Vector2f(glyph_dimensions);
+
+	RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+
+	FontAtlas::Allocation allocation;
+	if (!FontProvider::GetFontAtlas().Allocate(handle, glyph_dimensions, allocation))
+	{
+		// Glyphs too large for the atlas are never rendered, otherwise the atlas is only full for now.
+		return !FontAtlas::FitsOnPage(glyph_dimensions);
+	}
 
-		TextureBox& box = character_boxes[character];
+	box.texture_index = allocation.page_index;
+	box.texcoords[0] = allocation.texcoords[0];
+	box.texcoords[1] = allocation.texcoords[1];
 
-		if (box.texture_index != texture_id)
-			continue;
+	pending_textures.push_back(PendingTexture{&glyph, glyph_dimensions, allocation});
 
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
-			continue;
+	return true;
+}
 
-		const FontGlyph& glyph = it->second;
+void FontFaceLayer::GenerateTexture(const PendingTexture& pending_texture) const
+{
+	const FontGlyph& glyph = *pending_texture.glyph;
+	const FontAtlas::Allocation& allocation = pending_texture.allocation;
 
-		if (effect == nullptr)
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
 		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+			byte* destination = allocation.data;
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
 				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						// We use premultiplied alpha, so copy the alpha into all four channels.
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							for (int c = 0; c < 4; ++c)
-								destination[k * 4 + c] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
+				case ColorFormat::A8:
+				{
+					// We use premultiplied alpha, so copy the alpha into all four channels.
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						for (int c = 0; c < 4; ++c)
+							destination[k * 4 + c] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
+				{
+					memcpy(destination, source, num_bytes_per_line);
 				}
+				break;
+				}
+
+				destination += allocation.stride;
+				source += num_bytes_per_line;
 			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
 	}
-
-	return true;
-}
-
-const FontEffect* FontFaceLayer::GetFontEffect() const
-{
-	return effect.get();
+	else
+	{
+		effect->GenerateGlyphTexture(allocation.data, pending_texture.dimensions, allocation.stride, glyph);
+	}
 }
 
-Texture FontFaceLayer::GetTexture(RenderManager& render_manager, int index)
+FontFaceLayer::TextureBox FontFaceLayer::CloneGlyph(const TextureBox& cloned_box, const FontGlyph& glyph) const
 {
-	RMLUI_ASSERT(index >= 0);
-	RMLUI_ASSERT(index < GetNumTextures());
+	TextureBox box = cloned_box;
 
-	return (*textures_ptr)[index].GetTexture(render_manager);
-}
+	// Request the effect (if we have one) and adjust the origins as appropriate.
+	if (effect && !cloned_glyph_origins)
+	{
+		Vector2i glyph_origin = Vector2i(box.origin);
+		Vector2i glyph_dimensions = Vector2i(box.dimensions);
 
-int FontFaceLayer::GetNumTextures() const
-{
-	return (int)textures_ptr->size();
-}
+		if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+			box.origin = Vector2f(glyph_origin);
+		else
+			box.texture_index = -1;
+	}
 
-ColourbPremultiplied FontFaceLayer::GetColour(float opacity) const
-{
-	return colour.ToPremultiplied(opacity);
+	return box;
 }
 
 } // namespace Rml
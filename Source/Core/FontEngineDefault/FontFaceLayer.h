@@ -29,11 +29,11 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFACELAYER_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACELAYER_H
 
-#include "../../../Include/RmlUi/Core/CallbackTexture.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
 #include "../../../Include/RmlUi/Core/MeshUtilities.h"
-#include "../TextureLayout.h"
+#include "FontAtlas.h"
+#include "FontTypes.h"
 
 namespace Rml {
 
@@ -44,6 +44,8 @@ class FontFaceHandleDefault;
     A textured layer stored as part of a font face handle. Each handle will have at least a base
     layer for the standard font. Further layers can be added to allow rendering of text effects.
 
+    The glyph textures of all layers are placed in the shared font atlas.
+
     @author Peter Curry
  */
 
@@ -52,50 +54,54 @@ public:
 	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
 	~FontFaceLayer();
 
-	/// Generates or re-generates the character and texture data for the layer.
+	/// Generates the character and texture data for the layer.
 	/// @param[in] handle The handle generating this layer.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
 	/// @param[in] clone_glyph_origins True to keep the character origins from the cloned layer, false to generate new ones.
 	/// @return True if the layer was generated successfully, false if not.
-	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+	bool Generate(FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+
+	/// Adds a glyph to the generated layer, placing it in the font atlas unless we already have it. The texture coordinates of all other glyphs
+	/// remain unchanged, thus any geometry generated from this layer stays valid. If the atlas has no room for the glyph during the current
+	/// frame, it is not added.
+	/// @param[in] character The character of the glyph.
+	/// @param[in] glyph The glyph to add.
+	void AppendGlyph(Character character, const FontGlyph& glyph);
 
-	/// Generates the texture data for a layer (for the texture database).
-	/// @param[out] texture_data The generated texture data.
-	/// @param[out] texture_dimensions The dimensions of the texture.
-	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] glyphs The glyphs required by the font face handle.
-	bool GenerateTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs);
+	/// Removes all glyphs placed on the given atlas page, such as after the page has been evicted.
+	/// @param[in] page_index The index of the atlas page.
+	void RemoveGlyphsOnPage(int page_index);
 
 	/// Generates the geometry required to render a single character.
-	/// @param[out] mesh_list An array of meshes this layer will write to. It must be at least as big as the number of textures in this layer.
+	/// @param[out] mesh_list An array of meshes or glyph instance lists this layer will write to, one for each page of the font atlas.
+	/// @param[in] num_meshes The number of meshes in the array.
 	/// @param[in] character_code The character to generate geometry for.
 	/// @param[in] position The position of the baseline.
 	/// @param[in] colour The colour of the string.
-	inline void GenerateGeometry(TexturedMesh* mesh_list, const Character character_code, const Vector2f position,
+	/// @return False if the character has not been added to the layer or is placed outside the given meshes, otherwise true.
+	template <typename TexturedList>
+	inline bool GenerateGeometry(TexturedList* mesh_list, const int num_meshes, const Character character_code, const Vector2f position,
 		const ColourbPremultiplied colour) const
 	{
-		auto it = character_boxes.find(character_code);
-		if (it == character_boxes.end())
-			return;
+		const TextureBox* box_ptr = GetCharacterBox(character_code);
+		if (!box_ptr)
+			return false;
 
-		const TextureBox& box = it->second;
+		const TextureBox& box = *box_ptr;
 
 		if (box.texture_index < 0)
-			return;
+			return true;
+		if (box.texture_index >= num_meshes)
+			return false;
 
 		// Generate the geometry for the character.
-		Mesh& mesh = mesh_list[box.texture_index].mesh;
-		MeshUtilities::GenerateQuad(mesh, (position + box.origin).Round(), box.dimensions, colour, box.texcoords[0], box.texcoords[1]);
+		AddGlyph(mesh_list[box.texture_index], (position + box.origin).Round(), box, colour);
+		return true;
 	}
 
 	/// Returns the effect used to generate the layer.
 	const FontEffect* GetFontEffect() const;
 
-	/// Returns one of the layer's textures.
-	Texture GetTexture(RenderManager& render_manager, int index);
-	/// Returns the number of textures employed by this layer.
-	int GetNumTextures() const;
-
 	/// Returns the layer's colour after applying the given opacity.
 	ColourbPremultiplied GetColour(float opacity) const;
 
@@ -108,20 +114,61 @@ private:
 		// The texture coordinates for the character's geometry.
 		Vector2f texcoords[2];
 
-		// The texture this character renders from.
+		// The atlas page this character renders from, or -1 if the character is not rendered by this layer.
 		int texture_index = -1;
 	};
 
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
-	using TextureList = Vector<CallbackTextureSource>;
+
+	static void AddGlyph(TexturedMesh& textured_mesh, Vector2f position, const TextureBox& box, ColourbPremultiplied colour)
+	{
+		MeshUtilities::GenerateQuad(textured_mesh.mesh, position, box.dimensions, colour, box.texcoords[0], box.texcoords[1]);
+	}
+	static void AddGlyph(TexturedGlyphInstances& textured_instances, Vector2f position, const TextureBox& box, ColourbPremultiplied colour)
+	{
+		textured_instances.instances.push_back(GlyphInstance{position, box.dimensions, {box.texcoords[0], box.texcoords[1]}, colour});
+	}
+
+	// Returns the texture box of a character, or nullptr if the character has not been added to the layer.
+	const TextureBox* GetCharacterBox(const Character character) const
+	{
+		if (char32_t(character) < FontGlyphTableSize)
+			return character_box_table[char32_t(character)];
+
+		auto it = character_boxes.find(character);
+		return it != character_boxes.end() ? &it->second : nullptr;
+	}
+
+	// Point the character box table to the boxes of the characters it covers, must be called after modifying the character boxes.
+	void UpdateCharacterBoxTable();
+
+	// A glyph placed in the atlas, waiting for its texture data to be written.
+	struct PendingTexture {
+		const FontGlyph* glyph;
+		Vector2i dimensions;
+		FontAtlas::Allocation allocation;
+	};
+
+	// Places a glyph in the atlas and outputs its texture box. Unless the glyph is not rendered by this layer, its texture data is added to the
+	// pending textures, to be written with GenerateTexture(). Returns false if the atlas has no room for the glyph during the current frame.
+	bool PlaceGlyph(const FontGlyph& glyph, TextureBox& box);
+	// Writes the texture data of a placed glyph into the atlas. Safe to call concurrently for different glyphs.
+	void GenerateTexture(const PendingTexture& pending_texture) const;
+	// Returns the texture box of a glyph copied from the cloned layer.
+	TextureBox CloneGlyph(const TextureBox& cloned_box, const FontGlyph& glyph) const;
 
 	SharedPtr<const FontEffect> effect;
 
-	TextureList textures_owned;
-	TextureList* textures_ptr = &textures_owned;
+	FontFaceHandleDefault* handle = nullptr;
+
+	// The layer we share textures with, and whether we use its glyph origins, or nullptr if we place our own glyphs.
+	const FontFaceLayer* cloned_layer = nullptr;
+	bool cloned_glyph_origins = false;
 
-	TextureLayout texture_layout;
 	CharacterMap character_boxes;
+	Vector<PendingTexture> pending_textures;
+	// Direct lookup of the texture boxes of the first characters, or nullptr where the character has not been added.
+	const TextureBox* character_box_table[FontGlyphTableSize] = {};
 	Colourb colour;
 };
 
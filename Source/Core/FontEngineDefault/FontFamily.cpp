@@ -28,18 +28,37 @@
 
 #include "FontFamily.h"
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../../Include/RmlUi/Core/FileInterface.h"
 #include "../../../Include/RmlUi/Core/Math.h"
 #include "FontFace.h"
 #include <limits.h>
 
 namespace Rml {
 
+FontFaceMemory::FontFaceMemory(UniquePtr<byte[]> buffer, size_t size) : buffer(std::move(buffer))
+{
+	data = {this->buffer.get(), size};
+}
+
+FontFaceMemory::FontFaceMemory(FileInterface* file_interface, Span<const byte> mapped_data) : file_interface(file_interface), data(mapped_data) {}
+
+FontFaceMemory::~FontFaceMemory()
+{
+	if (file_interface)
+		file_interface->UnmapFile(data);
+}
+
+Span<const byte> FontFaceMemory::GetData() const
+{
+	return data;
+}
+
 FontFamily::FontFamily(const String& name) : name(name) {}
 
 FontFamily::~FontFamily()
 {
-	// Multiple face entries may share memory within a single font family, although only one of them owns it. Here we make sure that all the face
-	// destructors are run before all the memory is released. This way we don't leave any hanging references to invalidated memory.
+	// Multiple face entries may share memory within a single font family. Here we make sure that all the face destructors are run before any of
+	// the memory is released. This way we don't leave any hanging references to invalidated memory.
 	for (FontFaceEntry& entry : font_faces)
 		entry.face.reset();
 }
@@ -76,9 +95,8 @@ FontFaceHandleDefault* FontFamily::GetFaceHandle(Style::FontStyle style, Style::
 	return matching_face->GetHandle(size, true);
 }
 
-FontFace* FontFamily::AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, UniquePtr<byte[]> face_memory)
+FontFace* FontFamily::AddFace(UniquePtr<FontFace> face, SharedPtr<FontFaceMemory> face_memory)
 {
-	auto face = MakeUnique<FontFace>(ft_face, style, weight);
 	FontFace* result = face.get();
 
 	font_faces.push_back(FontFaceEntry{std::move(face), std::move(face_memory)});
@@ -29,13 +29,33 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFAMILY_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFAMILY_H
 
+#include "../../../Include/RmlUi/Core/Traits.h"
 #include "FontTypes.h"
 
 namespace Rml {
 
+class FileInterface;
 class FontFace;
 class FontFaceHandleDefault;
 
+/**
+    The memory of a font file, shared by all the faces loaded from it. Either read into a buffer, or memory-mapped through the file interface.
+ */
+class FontFaceMemory : NonCopyMoveable {
+public:
+	FontFaceMemory(UniquePtr<byte[]> buffer, size_t size);
+	FontFaceMemory(FileInterface* file_interface, Span<const byte> mapped_data);
+	~FontFaceMemory();
+
+	Span<const byte> GetData() const;
+
+private:
+	UniquePtr<byte[]> buffer;
+	// The file interface the memory was mapped through, or nullptr if the memory is owned by the buffer.
+	FileInterface* file_interface = nullptr;
+	Span<const byte> data;
+};
+
 /**
     @author Peter Curry
  */
@@ -53,12 +73,10 @@ public:
 	FontFaceHandleDefault* GetFaceHandle(Style::FontStyle style, Style::FontWeight weight, int size);
 
 	/// Adds a new face to the family.
-	/// @param[in] ft_face The previously loaded FreeType face.
-	/// @param[in] style The style of the new face.
-	/// @param[in] weight The weight of the new face.
-	/// @param[in] face_memory Optionally pass ownership of the face's memory to the face itself, automatically releasing it on destruction.
-	/// @return True if the face was loaded successfully, false otherwise.
-	FontFace* AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, UniquePtr<byte[]> face_memory);
+	/// @param[in] face The new face.
+	/// @param[in] face_memory Optionally share ownership of the face's memory, automatically releasing it once no longer used by any face.
+	/// @return The added face.
+	FontFace* AddFace(UniquePtr<FontFace> face, SharedPtr<FontFaceMemory> face_memory);
 
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	void ReleaseFontResources();
@@ -69,7 +87,7 @@ protected:
 	struct FontFaceEntry {
 		UniquePtr<FontFace> face;
 		// Only filled if we own the memory used by the face's FreeType handle. May be shared with other faces in this family.
-		UniquePtr<byte[]> face_memory;
+		SharedPtr<FontFaceMemory> face_memory;
 	};
 
 	using FontFaceList = Vector<FontFaceEntry>;
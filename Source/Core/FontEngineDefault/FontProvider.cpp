@@ -41,10 +41,14 @@
 namespace Rml {
 
 static FontProvider* g_font_provider = nullptr;
+static bool g_distance_field_resampling = false;
+static bool g_lazy_loading = false;
+static int g_num_worker_threads = 0;
 
 FontProvider::FontProvider()
 {
 	RMLUI_ASSERT(!g_font_provider);
+	font_workers.SetNumThreads(g_num_worker_threads);
 }
 
 FontProvider::~FontProvider()
@@ -103,11 +107,51 @@ FontFaceHandleDefault* FontProvider::GetFallbackFontFace(int index, int font_siz
 	return nullptr;
 }
 
+int FontProvider::GetFallbackFontFacesVersion()
+{
+	return Get().fallback_font_faces_version;
+}
+
 void FontProvider::ReleaseFontResources()
 {
 	RMLUI_ASSERT(g_font_provider);
 	for (auto& name_family : g_font_provider->font_families)
 		name_family.second->ReleaseFontResources();
+
+	g_font_provider->font_atlas.ReleaseUnusedPages();
+}
+
+void FontProvider::SetDistanceFieldResampling(bool enable)
+{
+	g_distance_field_resampling = enable;
+}
+
+void FontProvider::SetLazyLoading(bool enable)
+{
+	g_lazy_loading = enable;
+}
+
+void FontProvider::BeginFrame()
+{
+	if (g_font_provider)
+		g_font_provider->font_atlas.BeginFrame();
+}
+
+void FontProvider::SetNumWorkerThreads(int num_threads)
+{
+	g_num_worker_threads = Math::Max(num_threads, 0);
+	if (g_font_provider)
+		g_font_provider->font_workers.SetNumThreads(g_num_worker_threads);
+}
+
+FontAtlas& FontProvider::GetFontAtlas()
+{
+	return Get().font_atlas;
+}
+
+FontWorkers& FontProvider::GetFontWorkers()
+{
+	return Get().font_workers;
 }
 
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Style::FontWeight weight)
@@ -121,14 +165,29 @@ bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face, Sty
 		return false;
 	}
 
-	size_t length = file_interface->Length(handle);
+	SharedPtr<FontFaceMemory> face_memory;
+
+	// When loading lazily, try to map the file so that only the parts of it actually used are loaded into memory.
+	if (g_lazy_loading)
+	{
+		const Span<const byte> mapped_data = file_interface->MapFile(handle);
+		if (!mapped_data.empty())
+			face_memory = MakeShared<FontFaceMemory>(file_interface, mapped_data);
+	}
+
+	if (!face_memory)
+	{
+		size_t length = file_interface->Length(handle);
+
+		auto buffer_ptr = UniquePtr<byte[]>(new byte[length]);
+		file_interface->Read(buffer_ptr.get(), length, handle);
+		face_memory = MakeShared<FontFaceMemory>(std::move(buffer_ptr), length);
+	}
 
-	auto buffer_ptr = UniquePtr<byte[]>(new byte[length]);
-	byte* buffer = buffer_ptr.get();
-	file_interface->Read(buffer, length, handle);
 	file_interface->Close(handle);
 
-	bool result = Get().LoadFontFace({buffer, length}, fallback_face, std::move(buffer_ptr), file_name, {}, Style::FontStyle::Normal, weight);
+	const Span<const byte> data = face_memory->GetData();
+	bool result = Get().LoadFontFace(data, fallback_face, std::move(face_memory), file_name, {}, Style::FontStyle::Normal, weight);
 
 	return result;
 }
@@ -143,8 +202,8 @@ bool FontProvider::LoadFontFace(Span<const byte> data, const String& font_family
 	return result;
 }
 
-bool FontProvider::LoadFontFace(Span<const byte> data, bool fallback_face, UniquePtr<byte[]> face_memory, const String& source, String font_family,
-	Style::FontStyle style, Style::FontWeight weight)
+bool FontProvider::LoadFontFace(Span<const byte> data, bool fallback_face, SharedPtr<FontFaceMemory> face_memory, const String& source,
+	String font_family, Style::FontStyle style, Style::FontWeight weight)
 {
 	using Style::FontWeight;
 
@@ -205,34 +264,51 @@ bool FontProvider::LoadFontFace(Span<const byte> data, bool fallback_face, Uniqu
 
 	for (const FaceVariation& variation : load_variations)
 	{
-		FontFaceHandleFreetype ft_face = FreeType::LoadFace(data, source, variation.named_instance_index);
-		if (!ft_face)
-			return false;
-
-		if (font_family.empty())
-			FreeType::GetFaceStyle(ft_face, &font_family, &style, nullptr);
-		if (weight == FontWeight::Auto)
-			FreeType::GetFaceStyle(ft_face, nullptr, nullptr, &weight);
+		// When loading lazily, we only need to load the face here if its family or weight must be read from it.
+		FontFaceHandleFreetype ft_face = 0;
+		if (!g_lazy_loading || font_family.empty() || weight == FontWeight::Auto)
+		{
+			ft_face = FreeType::LoadFace(data, source, variation.named_instance_index);
+			if (!ft_face)
+				return false;
+
+			if (font_family.empty())
+				FreeType::GetFaceStyle(ft_face, &font_family, &style, nullptr);
+			if (weight == FontWeight::Auto)
+				FreeType::GetFaceStyle(ft_face, nullptr, nullptr, &weight);
+		}
 
 		const FontWeight variation_weight = (variation.weight == FontWeight::Auto ? weight : variation.weight);
 		const String font_face_description = GetFontFaceDescription(font_family, style, variation_weight);
 
-		if (!AddFace(ft_face, font_family, style, variation_weight, fallback_face, std::move(face_memory)))
+		UniquePtr<FontFace> face;
+		if (g_lazy_loading)
+		{
+			if (ft_face)
+				FreeType::ReleaseFace(ft_face);
+			face = MakeUnique<FontFace>(data, source, variation.named_instance_index, style, variation_weight, g_distance_field_resampling);
+		}
+		else
+		{
+			face = MakeUnique<FontFace>(ft_face, style, variation_weight, g_distance_field_resampling);
+		}
+
+		if (!AddFace(std::move(face), font_family, fallback_face, face_memory))
 		{
 			Log::Message(Log::LT_ERROR, "Failed to load font face %s from '%s'.", font_face_description.c_str(), source.c_str());
 			return false;
 		}
 
-		Log::Message(Log::LT_INFO, "Loaded font face %s from '%s'.", font_face_description.c_str(), source.c_str());
+		Log::Message(Log::LT_INFO, "%s font face %s from '%s'.", g_lazy_loading ? "Registered" : "Loaded", font_face_description.c_str(),
+			source.c_str());
 	}
 
 	return true;
 }
 
-bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face,
-	UniquePtr<byte[]> face_memory)
+bool FontProvider::AddFace(UniquePtr<FontFace> face, const String& family, bool fallback_face, SharedPtr<FontFaceMemory> face_memory)
 {
-	if (family.empty() || weight == Style::FontWeight::Auto)
+	if (family.empty() || face->GetWeight() == Style::FontWeight::Auto)
 		return false;
 
 	String family_lower = StringUtilities::ToLower(family);
@@ -249,7 +325,7 @@ bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, St
 		font_families[family_lower] = std::move(font_family_ptr);
 	}
 
-	FontFace* font_face_result = font_family->AddFace(face, style, weight, std::move(face_memory));
+	FontFace* font_face_result = font_family->AddFace(std::move(face), std::move(face_memory));
 
 	if (font_face_result && fallback_face)
 	{
@@ -257,6 +333,7 @@ bool FontProvider::AddFace(FontFaceHandleFreetype face, const String& family, St
 		if (it_fallback_face == fallback_font_faces.end())
 		{
 			fallback_font_faces.push_back(font_face_result);
+			fallback_font_faces_version += 1;
 		}
 	}
 
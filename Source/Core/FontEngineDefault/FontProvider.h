@@ -31,11 +31,14 @@
 
 #include "../../../Include/RmlUi/Core/StyleTypes.h"
 #include "../../../Include/RmlUi/Core/Types.h"
+#include "FontAtlas.h"
 #include "FontTypes.h"
+#include "FontWorkers.h"
 
 namespace Rml {
 
 class FontFace;
+class FontFaceMemory;
 class FontFamily;
 class FontFaceHandleDefault;
 
@@ -71,26 +74,52 @@ public:
 	/// Return a font face handle with the given index, at the given font size.
 	static FontFaceHandleDefault* GetFallbackFontFace(int index, int font_size);
 
+	/// Return the version of the fallback font faces, which changes whenever a fallback font face is added.
+	static int GetFallbackFontFacesVersion();
+
 	/// Releases resources owned by sized font faces, including their textures and rendered glyphs.
 	static void ReleaseFontResources();
 
+	/// Enables or disables resampling glyphs from signed distance fields, for font faces loaded from now on.
+	static void SetDistanceFieldResampling(bool enable);
+
+	/// Enables or disables lazy loading for font faces loaded from now on. Font files are then memory-mapped where supported by the file
+	/// interface, and each face is only loaded when it is first used.
+	static void SetLazyLoading(bool enable);
+
+	/// Starts a new frame of the font atlas, allowing glyphs rendered during previous frames to be evicted. Does nothing unless the default font
+	/// engine is initialized.
+	static void BeginFrame();
+
+	/// Sets the number of worker threads used to generate glyph textures.
+	static void SetNumWorkerThreads(int num_threads);
+
+	/// Returns the texture atlas shared by the glyphs of all font face handles.
+	static FontAtlas& GetFontAtlas();
+	/// Returns the worker threads used to generate glyph textures.
+	static FontWorkers& GetFontWorkers();
+
 private:
 	FontProvider();
 	~FontProvider();
 
 	static FontProvider& Get();
 
-	bool LoadFontFace(Span<const byte> data, bool fallback_face, UniquePtr<byte[]> face_memory, const String& source, String font_family,
+	bool LoadFontFace(Span<const byte> data, bool fallback_face, SharedPtr<FontFaceMemory> face_memory, const String& source, String font_family,
 		Style::FontStyle style, Style::FontWeight weight);
 
-	bool AddFace(FontFaceHandleFreetype face, const String& family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face,
-		UniquePtr<byte[]> face_memory);
+	bool AddFace(UniquePtr<FontFace> face, const String& family, bool fallback_face, SharedPtr<FontFaceMemory> face_memory);
 
 	using FontFaceList = Vector<FontFace*>;
 	using FontFamilyMap = UnorderedMap<String, UniquePtr<FontFamily>>;
 
+	// Declared before the font families, so that it outlives the handles with glyphs in the atlas.
+	FontAtlas font_atlas;
+	FontWorkers font_workers;
+
 	FontFamilyMap font_families;
 	FontFaceList fallback_font_faces;
+	int fallback_font_faces_version = 0;
 
 	static const String debugger_font_family_name;
 };
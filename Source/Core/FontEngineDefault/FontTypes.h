@@ -37,6 +37,9 @@ namespace Rml {
 
 using FontFaceHandleFreetype = uintptr_t;
 
+// Characters below this code point, covering ASCII and Latin-1, are looked up in directly indexed tables instead of hash maps.
+static constexpr char32_t FontGlyphTableSize = 256;
+
 struct FaceVariation {
 	Style::FontWeight weight;
 	uint16_t width;
@@ -0,0 +1,129 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FontWorkers.h"
+
+namespace Rml {
+
+FontWorkers::FontWorkers() {}
+
+FontWorkers::~FontWorkers()
+{
+	SetNumThreads(0);
+}
+
+void FontWorkers::SetNumThreads(int num_threads)
+{
+	if (!threads.empty())
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+		}
+		job_started.notify_all();
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		threads.clear();
+		stop = false;
+	}
+
+	for (int i = 0; i < num_threads; i++)
+		threads.emplace_back(&FontWorkers::WorkerLoop, this);
+}
+
+int FontWorkers::GetNumThreads() const
+{
+	return (int)threads.size();
+}
+
+void FontWorkers::ParallelFor(int count, const Function<void(int)>& function)
+{
+	if (count <= 0)
+		return;
+
+	if (threads.empty() || count == 1)
+	{
+		for (int i = 0; i < count; i++)
+			function(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job_function = &function;
+		job_count = count;
+		next_index = 0;
+		job_generation += 1;
+	}
+	job_started.notify_all();
+
+	// Help out on the calling thread, then wait for the workers to finish their last calls.
+	RunCalls();
+
+	std::unique_lock<std::mutex> lock(mutex);
+	job_finished.wait(lock, [this] { return num_active_workers == 0; });
+	job_function = nullptr;
+	job_count = 0;
+}
+
+void FontWorkers::WorkerLoop()
+{
+	uint64_t last_generation = 0;
+
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		job_started.wait(lock, [&] { return stop || (job_function && job_generation != last_generation); });
+		if (stop)
+			return;
+
+		last_generation = job_generation;
+		num_active_workers += 1;
+
+		lock.unlock();
+		RunCalls();
+		lock.lock();
+
+		num_active_workers -= 1;
+		if (num_active_workers == 0)
+			job_finished.notify_all();
+	}
+}
+
+void FontWorkers::RunCalls()
+{
+	const Function<void(int)>& function = *job_function;
+	const int count = job_count;
+
+	for (int i = next_index++; i < count; i = next_index++)
+		function(i);
+}
+
+} // namespace Rml
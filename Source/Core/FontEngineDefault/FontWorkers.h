@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTWORKERS_H
+#define RMLUI_CORE_FONTENGINEDEFAULT_FONTWORKERS_H
+
+#include "../../../Include/RmlUi/Core/Traits.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+/**
+    Worker threads used to generate glyph textures in parallel, such as when applying a font effect to all the glyphs of a new layer.
+
+    Without any worker threads, all work is done in order on the calling thread. This is the default, and gives deterministic behavior that does
+    not depend on the font effects being thread-safe.
+ */
+
+class FontWorkers : NonCopyMoveable {
+public:
+	FontWorkers();
+	~FontWorkers();
+
+	/// Sets the number of worker threads, stopping any existing threads first.
+	void SetNumThreads(int num_threads);
+	/// Returns the number of worker threads.
+	int GetNumThreads() const;
+
+	/// Calls the function once for every index in [0, count), distributed between the worker threads and the calling thread.
+	/// @param[in] count The number of calls.
+	/// @param[in] function The function to call, must be safe to call concurrently for different indices.
+	/// @note Returns only after all calls have completed.
+	void ParallelFor(int count, const Function<void(int)>& function);
+
+private:
+	void WorkerLoop();
+	// Runs calls of the current job until there are none left.
+	void RunCalls();
+
+	Vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable job_started;
+	std::condition_variable job_finished;
+
+	// The current job, protected by the mutex, except for the call counters which are updated atomically while the job runs.
+	const Function<void(int)>* job_function = nullptr;
+	int job_count = 0;
+	uint64_t job_generation = 0;
+	int num_active_workers = 0;
+	bool stop = false;
+
+	std::atomic<int> next_index{0};
+};
+
+} // namespace Rml
+#endif
@@ -189,7 +189,8 @@ void FreeType::GetFaceStyle(FontFaceHandleFreetype in_face, String* font_family,
 	}
 }
 
-bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs)
+bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, KerningScale& kerning_scale,
+	bool load_default_glyphs)
 {
 	FT_Face ft_face = (FT_Face)face;
 
@@ -199,6 +200,14 @@ bool FreeType::InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size,
 	if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor))
 		return false;
 
+	// Kerning is not supported for scaled bitmap fonts.
+	kerning_scale = {};
+	if (bitmap_scaling_factor == 1.0f)
+	{
+		kerning_scale.x_scale = int64_t(ft_face->size->metrics.x_scale);
+		kerning_scale.x_ppem = int(ft_face->size->metrics.x_ppem);
+	}
+
 	// Construct the initial list of glyphs.
 	BuildGlyphMap(ft_face, font_size, glyphs, bitmap_scaling_factor, load_default_glyphs);
 
@@ -226,31 +235,80 @@ bool FreeType::AppendGlyph(FontFaceHandleFreetype face, int font_size, Character
 	return true;
 }
 
-int FreeType::GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs)
+bool FreeType::RenderGlyphOutline(FontFaceHandleFreetype face, int reference_size, int font_size, Character character, FontGlyph& out_glyph)
 {
 	FT_Face ft_face = (FT_Face)face;
+	RMLUI_ASSERT(ft_face);
 
-	RMLUI_ASSERT(FT_HAS_KERNING(ft_face));
+	FT_UInt index = FT_Get_Char_Index(ft_face, (FT_ULong)character);
+	if (index == 0 || !FT_IS_SCALABLE(ft_face))
+		return false;
 
-	// Set face size again in case it was used at another size in another font face handle.
-	// Font size value of zero assumes it is already set.
-	if (font_size > 0)
+	float bitmap_scaling_factor = 1.0f;
+	if (!SetFontSize(ft_face, reference_size, bitmap_scaling_factor))
+		return false;
+
+	// Skip hinting, so that the outline can be scaled to any size.
+	bool result = false;
+	if (FT_Load_Glyph(ft_face, index, FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP) == 0 && ft_face->glyph->format == FT_GLYPH_FORMAT_OUTLINE &&
+		FT_Render_Glyph(ft_face->glyph, FT_RENDER_MODE_NORMAL) == 0 && ft_face->glyph->bitmap.pixel_mode == FT_PIXEL_MODE_GRAY)
 	{
-		float bitmap_scaling_factor = 1.0f;
-		if (!SetFontSize(ft_face, font_size, bitmap_scaling_factor) || bitmap_scaling_factor != 1.0f)
-			return 0;
+		FT_GlyphSlot ft_glyph = ft_face->glyph;
+
+		out_glyph.dimensions = {int(ft_glyph->metrics.width >> 6), int(ft_glyph->metrics.height >> 6)};
+		out_glyph.bearing = {ft_glyph->bitmap_left, ft_glyph->bitmap_top};
+		out_glyph.advance = int((ft_glyph->metrics.horiAdvance + 32) >> 6);
+		out_glyph.bitmap_dimensions = {int(ft_glyph->bitmap.width), int(ft_glyph->bitmap.rows)};
+		out_glyph.color_format = ColorFormat::A8;
+
+		const int num_bytes = out_glyph.bitmap_dimensions.x * out_glyph.bitmap_dimensions.y;
+		out_glyph.bitmap_owned_data.reset(num_bytes > 0 ? new byte[num_bytes] : nullptr);
+		out_glyph.bitmap_data = out_glyph.bitmap_owned_data.get();
+
+		for (int i = 0; i < out_glyph.bitmap_dimensions.y; ++i)
+			memcpy(out_glyph.bitmap_owned_data.get() + i * out_glyph.bitmap_dimensions.x, ft_glyph->bitmap.buffer + i * ft_glyph->bitmap.pitch,
+				out_glyph.bitmap_dimensions.x);
+
+		result = true;
 	}
 
+	// Restore the font size, as the caller may continue to use the face at this size, such as for kerning.
+	bitmap_scaling_factor = 1.0f;
+	SetFontSize(ft_face, font_size, bitmap_scaling_factor);
+
+	return result;
+}
+
+int FreeType::GetUnscaledKerning(FontFaceHandleFreetype face, Character lhs, Character rhs)
+{
+	FT_Face ft_face = (FT_Face)face;
+
+	RMLUI_ASSERT(FT_HAS_KERNING(ft_face));
+
+	// Unscaled kerning does not depend on the size currently set on the face, thus it can be shared between all font sizes.
 	FT_Vector ft_kerning;
 
 	FT_Error ft_error = FT_Get_Kerning(ft_face, FT_Get_Char_Index(ft_face, (FT_ULong)lhs), FT_Get_Char_Index(ft_face, (FT_ULong)rhs),
-		FT_KERNING_DEFAULT, &ft_kerning);
+		FT_KERNING_UNSCALED, &ft_kerning);
 
 	if (ft_error)
 		return 0;
 
-	int kerning = ft_kerning.x >> 6;
-	return kerning;
+	return int(ft_kerning.x);
+}
+
+int FreeType::ScaleKerning(const KerningScale& kerning_scale, int unscaled_kerning)
+{
+	// Matches the scaling of 'FT_Get_Kerning' in the default kerning mode.
+	FT_Pos kerning = FT_MulFix(FT_Pos(unscaled_kerning), FT_Fixed(kerning_scale.x_scale));
+
+	// FreeType scales down the kerning at small sizes to avoid it being too large after rounding.
+	if (kerning_scale.x_ppem < 25)
+		kerning = FT_MulDiv(kerning, kerning_scale.x_ppem, 25);
+
+	kerning = (kerning + 32) & -64;
+
+	return int(kerning >> 6);
 }
 
 bool FreeType::HasKerning(FontFaceHandleFreetype face)
@@ -36,6 +36,13 @@ namespace Rml {
 
 namespace FreeType {
 
+	// The scaling of kerning values from font units to pixels at a given font size.
+	struct KerningScale {
+		// The horizontal scale in 16.16 fixed point, or zero if kerning is not available at the font size.
+		int64_t x_scale = 0;
+		int x_ppem = 0;
+	};
+
 	// Initialize FreeType library.
 	bool Initialise();
 	// Shutdown FreeType library.
@@ -53,15 +60,22 @@ namespace FreeType {
 	// Retrieves the font family, style and weight of the given font face. Use nullptr to ignore a property.
 	void GetFaceStyle(FontFaceHandleFreetype face, String* font_family, Style::FontStyle* style, Style::FontWeight* weight);
 
-	// Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics are set.
-	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, bool load_default_glyphs);
+	// Initializes a face for a given font size. Glyphs are filled with the ASCII subset, and the font face metrics and kerning scale are set.
+	bool InitialiseFaceHandle(FontFaceHandleFreetype face, int font_size, FontGlyphMap& glyphs, FontMetrics& metrics, KerningScale& kerning_scale,
+		bool load_default_glyphs);
 
 	// Build a new glyph representing the given code point and append to 'glyphs'.
 	bool AppendGlyph(FontFaceHandleFreetype face, int font_size, Character character, FontGlyphMap& glyphs);
 
-	// Returns the kerning between two characters.
-	// 'font_size' value of zero assumes the font size is already set on the face, and skips this step for performance reasons.
-	int GetKerning(FontFaceHandleFreetype face, int font_size, Character lhs, Character rhs);
+	// Renders the outline of the glyph representing the given code point, without hinting, at the reference size. The font size of the face is
+	// restored to 'font_size' afterwards. Returns false if the glyph is not available as a scalable outline, such as for color or bitmap glyphs.
+	bool RenderGlyphOutline(FontFaceHandleFreetype face, int reference_size, int font_size, Character character, FontGlyph& out_glyph);
+
+	// Returns the kerning between two characters in font units, independent of the font size.
+	int GetUnscaledKerning(FontFaceHandleFreetype face, Character lhs, Character rhs);
+
+	// Converts an unscaled kerning value to pixels, rounded exactly like FreeType does when kerning at the given size.
+	int ScaleKerning(const KerningScale& kerning_scale, int unscaled_kerning);
 
 	// Returns true if the font face has kerning.
 	bool HasKerning(FontFaceHandleFreetype face);
@@ -58,4 +58,28 @@ Mesh Geometry::Release(ReleaseMode mode)
 	return mesh;
 }
 
+GlyphInstanceGeometry::GlyphInstanceGeometry(RenderManager* render_manager, StableVectorIndex resource_handle) :
+	UniqueRenderResource(render_manager, resource_handle)
+{}
+
+void GlyphInstanceGeometry::Render(Vector2f translation, Texture texture, ColourbPremultiplied colour) const
+{
+	if (resource_handle == StableVectorIndex::Invalid)
+		return;
+
+	translation = translation.Round();
+
+	RenderManagerAccess::Render(render_manager, *this, translation, texture, colour);
+}
+
+Vector<GlyphInstance> GlyphInstanceGeometry::Release()
+{
+	if (resource_handle == StableVectorIndex::Invalid)
+		return Vector<GlyphInstance>();
+
+	Vector<GlyphInstance> instances = RenderManagerAccess::ReleaseResource(render_manager, *this);
+	Clear();
+	return instances;
+}
+
 } // namespace Rml
@@ -50,6 +50,8 @@ public:
 	void AddAbsoluteElement(Element* element, Vector2f static_position, Element* static_relative_offset_parent);
 	// Adds a relatively positioned element which we act as a containing block for.
 	void AddRelativeElement(Element* element);
+	// Returns true if there are any absolutely positioned elements waiting to be formatted by this box.
+	bool HasAbsoluteElements() const { return !absolute_elements.empty(); }
 
 	ContainerBox* GetParent() { return parent_container; }
 	Element* GetElement() { return element; }
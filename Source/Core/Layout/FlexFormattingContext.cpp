@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "../../../Include/RmlUi/Core/Types.h"
 #include "ContainerBox.h"
+#include "LayoutCache.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
 #include <algorithm>
@@ -123,6 +124,11 @@ Vector2f FlexFormattingContext::GetMaxContentSize(Element* element)
 	// A large but finite number is used here, because the flexbox formatting algorithm
 	// needs to round numbers, and it doesn't support infinities.
 	const Vector2f infinity(10000.0f, 10000.0f);
+
+	LayoutCache* layout_cache = element->GetLayoutCache();
+	if (const Vector2f* cached_result = layout_cache->Find(LayoutCache::Mode::MaxContentSize, infinity, nullptr))
+		return *cached_result;
+
 	RootBox root(infinity);
 	auto flex_container_box = MakeUnique<FlexContainer>(element, &root);
 
@@ -137,6 +143,8 @@ Vector2f FlexFormattingContext::GetMaxContentSize(Element* element)
 	Vector2f flex_resulting_content_size, content_overflow_size;
 	float flex_baseline = 0.f;
 	context.Format(flex_resulting_content_size, content_overflow_size, flex_baseline);
+
+	layout_cache->Insert(LayoutCache::Mode::MaxContentSize, infinity, nullptr, flex_resulting_content_size);
 	return flex_resulting_content_size;
 }
 
@@ -363,9 +371,9 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 			if (initial_box_size.x < 0.f && flex_available_content_size.x >= 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
-			FormattingContext::FormatIndependent(flex_container_box, element, (format_box.GetSize().x >= 0 ? &format_box : nullptr),
-				FormattingContextType::Block);
-			item.inner_flex_base_size = element->GetBox().GetSize().y;
+			const Vector2f formatted_size = FormattingContext::FormatMeasure(flex_container_box, element,
+				(format_box.GetSize().x >= 0 ? &format_box : nullptr), FormattingContextType::Block);
+			item.inner_flex_base_size = formatted_size.y;
 
 			// Apply the automatic block size as minimum size (§4.5). Strictly speaking, we should also apply this to
 			// the other branches in column mode (and inline min-content size in row mode). However, the formatting step
@@ -706,8 +714,9 @@ void FlexFormattingContext::Format(Vector2f& flex_resulting_content_size, Vector
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(GetInnerUsedMainSize(item), content_size.y));
-					FormattingContext::FormatIndependent(flex_container_box, item.element, &item.box, FormattingContextType::Block);
-					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
+					const Vector2f formatted_size =
+						FormattingContext::FormatMeasure(flex_container_box, item.element, &item.box, FormattingContextType::Block);
+					item.hypothetical_cross_size = formatted_size.y + item.cross.sum_edges;
 				}
 				else
 				{
@@ -32,6 +32,8 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "BlockFormattingContext.h"
 #include "FlexFormattingContext.h"
+#include "LayoutCache.h"
+#include "LayoutDetails.h"
 #include "LayoutBox.h"
 #include "ReplacedFormattingContext.h"
 #include "TableFormattingContext.h"
@@ -77,4 +79,23 @@ UniquePtr<LayoutBox> FormattingContext::FormatIndependent(ContainerBox* parent_c
 	return nullptr;
 }
 
+Vector2f FormattingContext::FormatMeasure(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+	FormattingContextType backup_context)
+{
+	const Vector2f containing_block = LayoutDetails::GetContainingBlock(parent_container, element->GetPosition()).size;
+
+	LayoutCache* layout_cache = element->GetLayoutCache();
+	if (const Vector2f* cached_result = layout_cache->Find(LayoutCache::Mode::FormattedSize, containing_block, override_initial_box))
+		return *cached_result;
+
+	const bool formatted = (FormatIndependent(parent_container, element, override_initial_box, backup_context) != nullptr);
+	const Vector2f result = element->GetBox().GetSize();
+
+	// Only successful passes are cached, so that a failed pass is retried the next time.
+	if (formatted)
+		layout_cache->Insert(LayoutCache::Mode::FormattedSize, containing_block, override_initial_box, result);
+
+	return result;
+}
+
 } // namespace Rml
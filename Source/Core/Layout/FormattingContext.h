@@ -58,6 +58,17 @@ public:
 	static UniquePtr<LayoutBox> FormatIndependent(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
 		FormattingContextType backup_context);
 
+	/// Format the element in an independent formatting context to determine its resulting content size.
+	/// @note Intended for intermediate measuring passes, the element must be formatted once more before its layout is final. The result may be
+	/// retrieved from the element's layout cache, in which case no formatting takes place.
+	/// @param[in] parent_container The container box which should act as the new box's parent.
+	/// @param[in] element The element to be formatted.
+	/// @param[in] override_initial_box Optionally set the initial box dimensions, otherwise one will be generated based on the element's properties.
+	/// @param[in] backup_context If a formatting context can not be determined from the element's properties, use this context.
+	/// @return The content size of the element after formatting.
+	static Vector2f FormatMeasure(ContainerBox* parent_container, Element* element, const Box* override_initial_box,
+		FormattingContextType backup_context);
+
 protected:
 	FormattingContext() = default;
 	~FormattingContext() = default;
@@ -0,0 +1,84 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_LAYOUT_LAYOUTCACHE_H
+#define RMLUI_CORE_LAYOUT_LAYOUTCACHE_H
+
+#include "../../../Include/RmlUi/Core/Box.h"
+#include "../../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+    Stores the results of intermediate layout passes on an element.
+
+    Flexbox and table layout often format the same element several times under identical constraints, such as to find its
+    shrink-to-fit width or its height, before formatting it for real. For nested layouts, this quickly adds up. The cache
+    allows such measuring passes to be skipped, keyed by the formatting mode, containing block, and initial box.
+
+    The cache must be cleared whenever the layout of its element or any of its descendants may have changed.
+*/
+class LayoutCache {
+public:
+	enum class Mode : uint8_t {
+		ShrinkToFitWidth, // Width of the element under a maximum content constraint, see 'LayoutDetails::GetShrinkToFitWidth'.
+		MaxContentSize,   // Content size of a flex container without any constraints, see 'FlexFormattingContext::GetMaxContentSize'.
+		FormattedSize,    // Content size of the element after formatting it under the given box.
+	};
+
+	/// Looks up the result of a previous layout pass.
+	/// @param[in] mode The layout pass that produced the result.
+	/// @param[in] containing_block The size of the containing block used during the pass.
+	/// @param[in] box The initial box of the element during the pass, or nullptr if none was provided.
+	/// @return The stored result, or nullptr if it was not found.
+	const Vector2f* Find(Mode mode, Vector2f containing_block, const Box* box) const;
+
+	/// Stores the result of a layout pass, possibly replacing an older entry.
+	void Insert(Mode mode, Vector2f containing_block, const Box* box, Vector2f result);
+
+	/// Removes all entries.
+	void Clear();
+
+private:
+	struct Entry {
+		Mode mode;
+		bool has_box;
+		Vector2f containing_block;
+		Box box;
+		Vector2f result;
+	};
+
+	// Usually only a few different constraints are used for each element, limit the cache to a small size.
+	static constexpr int MaxNumEntries = 4;
+
+	Vector<Entry> entries;
+	int next_replace_index = 0;
+};
+
+} // namespace Rml
+#endif
@@ -35,6 +35,7 @@
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "ContainerBox.h"
 #include "FormattingContext.h"
+#include "LayoutCache.h"
 #include "LayoutEngine.h"
 #include <float.h>
 
@@ -270,6 +271,11 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	const float max_content_constraint_width = containing_block.x + 10000.f;
 	box.SetContent({max_content_constraint_width, box.GetSize().y});
 
+	// Reuse the result from a previous pass under the same constraints, if it is still valid.
+	LayoutCache* layout_cache = element->GetLayoutCache();
+	if (const Vector2f* cached_result = layout_cache->Find(LayoutCache::Mode::ShrinkToFitWidth, containing_block, &box))
+		return cached_result->x;
+
 	// First, format the element under the above generated box. Then we ask the resulting box for its shrink-to-fit
 	// width. For block containers, this is essentially its largest line or child box.
 	// @performance. Some formatting can be simplified, e.g. absolute elements do not contribute to the shrink-to-fit
@@ -284,6 +290,8 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 			Math::Max(0.f, containing_block.x - box.GetSizeAcross(BoxDirection::Horizontal, BoxArea::Margin, BoxArea::Padding));
 		shrink_to_fit_width = Math::Min(shrink_to_fit_width, available_width);
 	}
+
+	layout_cache->Insert(LayoutCache::Mode::ShrinkToFitWidth, containing_block, &box, Vector2f(shrink_to_fit_width, 0.f));
 	return shrink_to_fit_width;
 }
 
@@ -320,6 +328,42 @@ String LayoutDetails::GetDebugElementName(Element* element)
 	return element->GetAddress(false, false);
 }
 
+bool LayoutDetails::IsLayoutBoundary(Element* element)
+{
+	using namespace Style;
+	if (element->IsReplaced())
+		return false;
+
+	const ComputedValues& computed = element->GetComputedValues();
+
+	// Only consider block-level boxes that establish an independent formatting context. Inline-level boxes and tables
+	// can be sized or aligned by their contents, and table parts are sized by their table.
+	const Display display = computed.display();
+	if (display != Display::Block && display != Display::FlowRoot && display != Display::Flex)
+		return false;
+
+	// Scroll containers catch all their own overflow, so that only their border box is visible to their ancestors.
+	if (!IsScrollContainer(computed.overflow_x(), computed.overflow_y()))
+		return false;
+
+	// The size must be definite without considering the containing block, or the contents.
+	if (computed.width().type != Width::Length || computed.height().type != Height::Length)
+		return false;
+	if (computed.min_width().type == MinWidth::Percentage || computed.max_width().type == MaxWidth::Percentage ||
+		computed.min_height().type == MinHeight::Percentage || computed.max_height().type == MaxHeight::Percentage)
+		return false;
+
+	// Flex items are sized by the flex layout of their parent.
+	Element* parent = element->GetParentNode();
+	if (!parent)
+		return false;
+	const Display parent_display = parent->GetDisplay();
+	if (parent_display == Display::Flex || parent_display == Display::InlineFlex)
+		return false;
+
+	return true;
+}
+
 Vector2f LayoutDetails::CalculateSizeForReplacedElement(const Vector2f specified_content_size, const Vector2f min_size, const Vector2f max_size,
 	const Vector2f intrinsic_size, const float intrinsic_ratio)
 {
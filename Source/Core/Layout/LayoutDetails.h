@@ -119,6 +119,11 @@ public:
 
 	static String GetDebugElementName(Element* element);
 
+	/// Returns true if the element acts as a layout boundary, that is, its box and visible overflow can not change when its contents change.
+	/// The contents of such an element can be formatted on their own, without formatting the rest of the document.
+	/// @note The element can still depend on its parent's layout, which must be formatted if the element's own properties change.
+	static bool IsLayoutBoundary(Element* element);
+
 	static bool IsScrollContainer(Style::Overflow overflow_x, Style::Overflow overflow_y)
 	{
 		return overflow_x != Style::Overflow::Visible || overflow_y != Style::Overflow::Visible;
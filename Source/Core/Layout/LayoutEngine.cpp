@@ -27,11 +27,14 @@
  */
 
 #include "LayoutEngine.h"
+#include "../../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../../Include/RmlUi/Core/Element.h"
+#include "../../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Profiling.h"
 #include "ContainerBox.h"
 #include "FormattingContext.h"
+#include "LayoutDetails.h"
 
 namespace Rml {
 
@@ -58,4 +61,74 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block)
 	}
 }
 
+// Returns true if the element's own layout may depend on the baseline of the last line inside its descendants.
+static bool IsBaselineDependentOnDescendants(Element* element)
+{
+	using Style::Display;
+	const ComputedValues& computed = element->GetComputedValues();
+	const Display display = computed.display();
+
+	if (display == Display::InlineBlock)
+		return !LayoutDetails::IsScrollContainer(computed.overflow_x(), computed.overflow_y());
+	if (display == Display::InlineFlex || display == Display::InlineTable || display == Display::TableCell)
+		return true;
+
+	// Flex items may be aligned by their baseline.
+	Element* parent = element->GetParentNode();
+	return parent && (parent->GetDisplay() == Display::Flex || parent->GetDisplay() == Display::InlineFlex);
+}
+
+Element* LayoutEngine::FindLayoutBoundary(Element* element)
+{
+	Element* document = (element ? element->GetOwnerDocument() : nullptr);
+	Element* layout_boundary = nullptr;
+
+	for (Element* ancestor = element; ancestor && ancestor != document; ancestor = ancestor->GetParentNode())
+	{
+		if (!layout_boundary)
+		{
+			if (LayoutDetails::IsLayoutBoundary(ancestor))
+				layout_boundary = ancestor;
+		}
+		else if (IsBaselineDependentOnDescendants(ancestor))
+		{
+			// The baseline of the boundary's last line can leak out to the layout of its ancestors, in which case they
+			// need to be formatted as well. Be conservative and format the whole document.
+			return nullptr;
+		}
+	}
+
+	if (!document)
+		return nullptr;
+
+	return layout_boundary;
+}
+
+bool LayoutEngine::FormatLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element);
+	RMLUI_ZoneScoped;
+
+	if (!LayoutDetails::IsLayoutBoundary(element))
+		return false;
+
+	// The boundary's box is independent of its contents, so we can simply format it again using its current box.
+	// Neither the containing block nor any percentage sizes are used in this case, so using the box itself as the root
+	// is sufficient. The offset of the element is left untouched, as it is determined by its parent's layout.
+	const Box box = element->GetBox();
+	RootBox root(box);
+
+	auto layout_box = FormattingContext::FormatIndependent(&root, element, &box, FormattingContextType::Block);
+	if (!layout_box)
+		return false;
+
+	// Absolutely positioned descendants with a containing block outside the boundary are placed by our ancestors.
+	if (root.HasAbsoluteElements())
+		return false;
+
+	element->ClampScrollOffsetRecursive();
+
+	return true;
+}
+
 } // namespace Rml
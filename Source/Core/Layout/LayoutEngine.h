@@ -47,6 +47,16 @@ public:
 	/// @param[in] element The element to lay out.
 	/// @param[in] containing_block The size of the containing block.
 	static void FormatElement(Element* element, Vector2f containing_block);
+
+	/// Finds the layout boundary which needs to be formatted when the layout of the given element changes.
+	/// @param[in] element The first element to consider, usually the parent of the element whose layout changed.
+	/// @return The nearest layout boundary at or above the given element, or nullptr if the whole document must be formatted.
+	static Element* FindLayoutBoundary(Element* element);
+
+	/// Formats the contents of a layout boundary on its own, keeping its current box and position.
+	/// @param[in] element The layout boundary to format, previously formatted as part of its document.
+	/// @return False if the layout could not be contained within the element, then the whole document must be formatted.
+	static bool FormatLayoutBoundary(Element* element);
 };
 
 } // namespace Rml
@@ -306,8 +306,7 @@ void TableFormattingContext::DetermineRowHeights(TrackBoxList& rows, BoxList& ce
 				// If both the row and the cell heights are 'auto', we need to format the cell to get its height.
 				if (box.GetSize().y < 0)
 				{
-					FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
-					box.SetContent(element_cell->GetBox().GetSize());
+					box.SetContent(FormattingContext::FormatMeasure(table_wrapper_box, element_cell, &box, FormattingContextType::Block));
 				}
 
 				// Find the height of the cell which applies only to this row.
@@ -429,8 +428,7 @@ void TableFormattingContext::FormatCells(BoxList& cells, Vector2f& table_overflo
 			if (is_aligned)
 			{
 				// We need to format the cell to know how much padding to add.
-				FormattingContext::FormatIndependent(table_wrapper_box, element_cell, &box, FormattingContextType::Block);
-				box.SetContent(element_cell->GetBox().GetSize());
+				box.SetContent(FormattingContext::FormatMeasure(table_wrapper_box, element_cell, &box, FormattingContextType::Block));
 			}
 			else
 			{
@@ -88,7 +88,7 @@ namespace Detail {
 
 	BasicStackAllocator& GetGlobalBasicStackAllocator()
 	{
-		static BasicStackAllocator stack_allocator(10 * 1024);
+		static thread_local BasicStackAllocator stack_allocator(10 * 1024);
 		return stack_allocator;
 	}
 
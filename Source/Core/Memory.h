@@ -69,7 +69,7 @@ namespace Detail {
 
     Can very cheaply allocate memory using the global stack allocator. Memory will be allocated from the
     heap on the very first construction of a global stack allocator, and will persist and be re-used after.
-    Falls back to malloc if there is not enough space left.
+    Falls back to malloc if there is not enough space left. Each thread has its own stack.
 
     Warning: Using this is dangerous as deallocation must happen in exact reverse order of allocation.
       Memory is shared between different global stack allocators. Should only be used for highly localized code,
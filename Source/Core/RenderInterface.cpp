@@ -90,4 +90,20 @@ void RenderInterface::RenderShader(CompiledShaderHandle /*shader*/, CompiledGeom
 
 void RenderInterface::ReleaseShader(CompiledShaderHandle /*shader*/) {}
 
+bool RenderInterface::IsGlyphInstancingSupported()
+{
+	return false;
+}
+
+CompiledGeometryHandle RenderInterface::CompileGlyphInstances(Span<const GlyphInstance> /*instances*/)
+{
+	return CompiledGeometryHandle{};
+}
+
+void RenderInterface::RenderGlyphInstances(CompiledGeometryHandle /*instances*/, Vector2f /*translation*/, TextureHandle /*texture*/,
+	ColourbPremultiplied /*colour*/)
+{}
+
+void RenderInterface::ReleaseGlyphInstances(CompiledGeometryHandle /*instances*/) {}
+
 } // namespace Rml
@@ -51,6 +51,7 @@ RenderManager::~RenderManager()
 	};
 	ResourceCount elements[] = {
 		{"Geometry", (int)geometry_list.size()},
+		{"GlyphInstanceGeometry", (int)glyph_instance_list.size()},
 		{"CompiledFilter", compiled_filter_count},
 		{"CompiledShader", compiled_shader_count},
 		{"CallbackTexture", (int)texture_database->callback_database.size()},
@@ -65,6 +66,7 @@ RenderManager::~RenderManager()
 		}
 	}
 
+	ReleaseGeometryBatches();
 	ReleaseAllTextures();
 }
 
@@ -78,6 +80,9 @@ void RenderManager::PrepareRender(Vector2i dimensions)
 	RMLUI_ASSERTMSG(render_stack.empty(), "Unbalanced render stack detected, ensure every PushLayer call has a corresponding call to PopLayer.");
 #endif
 
+	ReleaseGeometryBatches();
+	ReleaseInvalidatedTextures();
+
 	SetViewport(dimensions);
 }
 
@@ -96,6 +101,21 @@ Geometry RenderManager::MakeGeometry(Mesh&& mesh)
 	return Geometry(this, InsertGeometry(std::move(mesh)));
 }
 
+bool RenderManager::IsGlyphInstancingSupported()
+{
+	if (!glyph_instancing_detected)
+	{
+		glyph_instancing_detected = true;
+		glyph_instancing_supported = render_interface->IsGlyphInstancingSupported();
+	}
+	return glyph_instancing_supported;
+}
+
+GlyphInstanceGeometry RenderManager::MakeGlyphInstanceGeometry(Vector<GlyphInstance>&& instances)
+{
+	return GlyphInstanceGeometry(this, glyph_instance_list.insert(GlyphInstanceData{std::move(instances), CompiledGeometryHandle{}}));
+}
+
 Texture RenderManager::LoadTexture(const String& source, const String& document_path)
 {
 	String path;
@@ -122,16 +142,17 @@ void RenderManager::SetScissorRegion(Rectanglei new_region)
 	const bool old_scissor_enable = state.scissor_region.Valid();
 	const bool new_scissor_enable = new_region.Valid();
 
-	if (new_scissor_enable != old_scissor_enable)
-		render_interface->EnableScissorRegion(new_scissor_enable);
-
 	if (new_scissor_enable)
-	{
 		new_region = new_region.Intersect(Rectanglei::FromSize(viewport_dimensions));
 
-		if (new_region != state.scissor_region)
-			render_interface->SetScissorRegion(new_region);
-	}
+	if (new_scissor_enable != old_scissor_enable || (new_scissor_enable && new_region != state.scissor_region))
+		FlushGeometryBatch();
+
+	if (new_scissor_enable != old_scissor_enable)
+		render_interface->EnableScissorRegion(new_scissor_enable);
+
+	if (new_scissor_enable && new_region != state.scissor_region)
+		render_interface->SetScissorRegion(new_region);
 
 	state.scissor_region = new_region;
 }
@@ -173,6 +194,7 @@ void RenderManager::SetTransform(const Matrix4f* p_new_transform)
 
 	if (state.transform != new_transform)
 	{
+		FlushGeometryBatch();
 		render_interface->SetTransform(p_new_transform);
 		state.transform = new_transform;
 	}
@@ -180,6 +202,8 @@ void RenderManager::SetTransform(const Matrix4f* p_new_transform)
 
 void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 {
+	FlushGeometryBatch();
+
 	const bool clip_mask_enabled = !clip_elements.empty();
 	render_interface->EnableClipMask(clip_mask_enabled);
 
@@ -202,6 +226,9 @@ void RenderManager::ApplyClipMask(const ClipMaskGeometryList& clip_elements)
 
 void RenderManager::SetState(const RenderState& next)
 {
+	// Submit any pending geometry, this is also used to finish off the frame.
+	FlushGeometryBatch();
+
 	SetScissorRegion(next.scissor_region);
 
 	SetClipMask(next.clip_mask_list);
@@ -244,13 +271,30 @@ void RenderManager::Render(const Geometry& geometry, Vector2f translation, Textu
 		return;
 	}
 
+	if (geometry_batching && !shader)
+	{
+		if (geometry_list[geometry.resource_handle].mesh.indices.empty())
+			return;
+
+		// Callback textures may render to the current layer when first generated, so submit pending geometry before that.
+		if (texture.callback_index != StableVectorIndex::Invalid && !texture_database->callback_database.IsLoaded(texture.callback_index))
+			FlushGeometryBatch();
+
+		const TextureHandle texture_handle = GetTextureHandle(texture);
+
+		if (!batch_list.empty() && texture_handle != batch_texture)
+			FlushGeometryBatch();
+
+		batch_texture = texture_handle;
+		batch_list.push_back(BatchedGeometry{geometry.resource_handle, translation});
+		return;
+	}
+
+	FlushGeometryBatch();
+
 	if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(geometry.resource_handle))
 	{
-		TextureHandle texture_handle = {};
-		if (texture.file_index != TextureFileIndex::Invalid)
-			texture_handle = texture_database->file_database.GetHandle(render_interface, texture.file_index);
-		else if (texture.callback_index != StableVectorIndex::Invalid)
-			texture_handle = texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+		const TextureHandle texture_handle = GetTextureHandle(texture);
 
 		if (shader)
 			render_interface->RenderShader(shader.resource_handle, geometry_handle, translation, texture_handle);
@@ -259,6 +303,117 @@ void RenderManager::Render(const Geometry& geometry, Vector2f translation, Textu
 	}
 }
 
+void RenderManager::Render(const GlyphInstanceGeometry& geometry, Vector2f translation, Texture texture, ColourbPremultiplied colour)
+{
+	RMLUI_ASSERT(geometry);
+	if (geometry.render_manager != this || (texture && texture.render_manager != this))
+	{
+		RMLUI_ERRORMSG("Trying to render glyph instances with resources constructed in different render managers.");
+		return;
+	}
+
+	FlushGeometryBatch();
+
+	GlyphInstanceData& data = glyph_instance_list[geometry.resource_handle];
+	if (!data.handle && !data.instances.empty())
+	{
+		data.handle = render_interface->CompileGlyphInstances(data.instances);
+
+		if (!data.handle)
+			Log::Message(Log::LT_ERROR, "Got empty compiled glyph instances.");
+	}
+
+	if (data.handle)
+		render_interface->RenderGlyphInstances(data.handle, translation, GetTextureHandle(texture), colour);
+}
+
+TextureHandle RenderManager::GetTextureHandle(Texture texture)
+{
+	if (texture.file_index != TextureFileIndex::Invalid)
+		return texture_database->file_database.GetHandle(render_interface, texture.file_index);
+	else if (texture.callback_index != StableVectorIndex::Invalid)
+		return texture_database->callback_database.GetHandle(this, render_interface, texture.callback_index);
+	return {};
+}
+
+void RenderManager::EnableGeometryBatching(bool enable)
+{
+	FlushGeometryBatch();
+	geometry_batching = enable;
+}
+
+bool RenderManager::IsGeometryBatchingEnabled() const
+{
+	return geometry_batching;
+}
+
+void RenderManager::FlushGeometryBatch()
+{
+	if (batch_list.empty())
+		return;
+
+	if (batch_list.size() == 1)
+	{
+		// Nothing to merge, render the geometry directly to avoid copying its mesh.
+		const BatchedGeometry& batched = batch_list.front();
+		if (CompiledGeometryHandle geometry_handle = GetCompiledGeometryHandle(batched.geometry))
+			render_interface->RenderGeometry(geometry_handle, batched.translation, batch_texture);
+	}
+	else
+	{
+		// Reuse the mesh buffers from previous frames, they are no longer referenced by the render interface at this point.
+		if (num_batch_geometry == batch_geometry_list.size())
+			batch_geometry_list.emplace_back();
+
+		GeometryData& batch_geometry = batch_geometry_list[num_batch_geometry];
+		num_batch_geometry += 1;
+
+		Mesh& mesh = batch_geometry.mesh;
+		mesh.vertices.clear();
+		mesh.indices.clear();
+
+		for (const BatchedGeometry& batched : batch_list)
+		{
+			const Mesh& source = geometry_list[batched.geometry].mesh;
+			const int index_offset = (int)mesh.vertices.size();
+
+			for (const Vertex& vertex : source.vertices)
+			{
+				mesh.vertices.push_back(vertex);
+				mesh.vertices.back().position += batched.translation;
+			}
+			for (int index : source.indices)
+				mesh.indices.push_back(index + index_offset);
+		}
+
+		batch_geometry.handle = render_interface->CompileGeometry(mesh.vertices, mesh.indices);
+		if (batch_geometry.handle)
+			render_interface->RenderGeometry(batch_geometry.handle, Vector2f(0.f), batch_texture);
+		else
+			Log::Message(Log::LT_ERROR, "Got empty compiled geometry.");
+	}
+
+	batch_list.clear();
+	batch_texture = {};
+}
+
+void RenderManager::ReleaseGeometryBatches()
+{
+	RMLUI_ASSERTMSG(batch_list.empty(), "Pending geometry batch was never submitted, ensure the render state is reset at the end of the frame.");
+	batch_list.clear();
+
+	for (size_t i = 0; i < num_batch_geometry; i++)
+	{
+		GeometryData& batch_geometry = batch_geometry_list[i];
+		if (batch_geometry.handle)
+		{
+			render_interface->ReleaseGeometry(batch_geometry.handle);
+			batch_geometry.handle = {};
+		}
+	}
+	num_batch_geometry = 0;
+}
+
 void RenderManager::GetTextureSourceList(StringList& source_list) const
 {
 	texture_database->file_database.GetSourceList(source_list);
@@ -271,12 +426,23 @@ bool RenderManager::ReleaseTexture(const String& texture_source)
 
 void RenderManager::ReleaseAllTextures()
 {
+	ReleaseInvalidatedTextures();
 	texture_database->callback_database.ReleaseAllTextures(render_interface);
 	texture_database->file_database.ReleaseAllTextures(render_interface);
 }
 
+void RenderManager::ReleaseInvalidatedTextures()
+{
+	for (TextureHandle texture_handle : invalidated_textures)
+		render_interface->ReleaseTexture(texture_handle);
+	invalidated_textures.clear();
+}
+
 void RenderManager::ReleaseAllCompiledGeometry()
 {
+	FlushGeometryBatch();
+	ReleaseGeometryBatches();
+
 	geometry_list.for_each([this](GeometryData& data) {
 		if (data.handle)
 		{
@@ -284,6 +450,14 @@ void RenderManager::ReleaseAllCompiledGeometry()
 			data.handle = {};
 		}
 	});
+
+	glyph_instance_list.for_each([this](GlyphInstanceData& data) {
+		if (data.handle)
+		{
+			render_interface->ReleaseGlyphInstances(data.handle);
+			data.handle = {};
+		}
+	});
 }
 
 CompiledFilter RenderManager::CompileFilter(const String& name, const Dictionary& parameters)
@@ -310,6 +484,7 @@ CompiledShader RenderManager::CompileShader(const String& name, const Dictionary
 
 LayerHandle RenderManager::PushLayer()
 {
+	FlushGeometryBatch();
 	const LayerHandle layer = render_interface->PushLayer();
 	render_stack.push_back(layer);
 	return layer;
@@ -319,12 +494,14 @@ void RenderManager::CompositeLayers(LayerHandle source, LayerHandle destination,
 {
 	RMLUI_ASSERT(source == 0 || std::find(render_stack.begin(), render_stack.end(), source) != render_stack.end());
 	RMLUI_ASSERT(destination == 0 || std::find(render_stack.begin(), render_stack.end(), destination) != render_stack.end());
+	FlushGeometryBatch();
 	render_interface->CompositeLayers(source, destination, blend_mode, filters);
 }
 
 void RenderManager::PopLayer()
 {
 	RMLUI_ASSERT(!render_stack.empty());
+	FlushGeometryBatch();
 	render_interface->PopLayer();
 	render_stack.pop_back();
 }
@@ -342,6 +519,7 @@ LayerHandle RenderManager::GetNextLayer() const
 
 CompiledFilter RenderManager::SaveLayerAsMaskImage()
 {
+	FlushGeometryBatch();
 	if (CompiledFilterHandle handle = render_interface->SaveLayerAsMaskImage())
 	{
 		compiled_filter_count += 1;
@@ -361,6 +539,9 @@ Mesh RenderManager::ReleaseResource(const Geometry& geometry)
 {
 	RMLUI_ASSERT(geometry.render_manager == this && geometry.resource_handle != geometry.InvalidHandle());
 
+	// The geometry may still be referenced by the pending batch.
+	FlushGeometryBatch();
+
 	GeometryData& data = geometry_list[geometry.resource_handle];
 	if (data.handle)
 	{
@@ -372,6 +553,21 @@ Mesh RenderManager::ReleaseResource(const Geometry& geometry)
 	return result;
 }
 
+Vector<GlyphInstance> RenderManager::ReleaseResource(const GlyphInstanceGeometry& geometry)
+{
+	RMLUI_ASSERT(geometry.render_manager == this && geometry.resource_handle != geometry.InvalidHandle());
+
+	GlyphInstanceData& data = glyph_instance_list[geometry.resource_handle];
+	if (data.handle)
+	{
+		render_interface->ReleaseGlyphInstances(data.handle);
+		data.handle = {};
+	}
+	Vector<GlyphInstance> result = std::exchange(data.instances, Vector<GlyphInstance>());
+	glyph_instance_list.erase(geometry.resource_handle);
+	return result;
+}
+
 void RenderManager::ReleaseResource(const CompiledFilter& filter)
 {
 	RMLUI_ASSERT(filter.render_manager == this && filter.resource_handle != filter.InvalidHandle());
@@ -39,15 +39,33 @@ Vector2i RenderManagerAccess::GetDimensions(RenderManager* render_manager, Textu
 
 Vector2i RenderManagerAccess::GetDimensions(RenderManager* render_manager, StableVectorIndex callback_texture)
 {
+	// Generating the texture may render to the current layer, make sure any pending geometry is submitted first.
+	if (!render_manager->texture_database->callback_database.IsLoaded(callback_texture))
+		render_manager->FlushGeometryBatch();
 	return render_manager->texture_database->callback_database.GetDimensions(render_manager, render_manager->render_interface, callback_texture);
 }
 
+void RenderManagerAccess::InvalidateTexture(RenderManager* render_manager, StableVectorIndex callback_texture)
+{
+	// Pending geometry refers to the texture by its callback, make sure it is submitted with the current texture handle. Render
+	// calls already submitted during this frame may still use the old handle, thus its release is deferred to the next frame.
+	render_manager->FlushGeometryBatch();
+	if (TextureHandle texture_handle = render_manager->texture_database->callback_database.InvalidateTexture(callback_texture))
+		render_manager->invalidated_textures.push_back(texture_handle);
+}
+
 void RenderManagerAccess::Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture,
 	const CompiledShader& shader)
 {
 	render_manager->Render(geometry, translation, texture, shader);
 }
 
+void RenderManagerAccess::Render(RenderManager* render_manager, const GlyphInstanceGeometry& geometry, Vector2f translation, Texture texture,
+	ColourbPremultiplied colour)
+{
+	render_manager->Render(geometry, translation, texture, colour);
+}
+
 void RenderManagerAccess::GetTextureSourceList(RenderManager* render_manager, StringList& source_list)
 {
 	render_manager->GetTextureSourceList(source_list);
@@ -63,6 +81,11 @@ void RenderManagerAccess::ReleaseAllTextures(RenderManager* render_manager)
 	render_manager->ReleaseAllTextures();
 }
 
+void RenderManagerAccess::ReleaseInvalidatedTextures(RenderManager* render_manager)
+{
+	render_manager->ReleaseInvalidatedTextures();
+}
+
 void RenderManagerAccess::ReleaseAllCompiledGeometry(RenderManager* render_manager)
 {
 	render_manager->ReleaseAllCompiledGeometry();
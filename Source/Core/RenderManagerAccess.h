@@ -39,6 +39,7 @@ class CompiledFilter;
 class CompiledShader;
 class CallbackTexture;
 class Geometry;
+class GlyphInstanceGeometry;
 class Texture;
 
 class RenderManagerAccess {
@@ -51,25 +52,31 @@ private:
 
 	static Vector2i GetDimensions(RenderManager* render_manager, TextureFileIndex texture);
 	static Vector2i GetDimensions(RenderManager* render_manager, StableVectorIndex callback_texture);
+	static void InvalidateTexture(RenderManager* render_manager, StableVectorIndex callback_texture);
 
 	static void Render(RenderManager* render_manager, const Geometry& geometry, Vector2f translation, Texture texture, const CompiledShader& shader);
+	static void Render(RenderManager* render_manager, const GlyphInstanceGeometry& geometry, Vector2f translation, Texture texture,
+		ColourbPremultiplied colour);
 
 	static void GetTextureSourceList(RenderManager* render_manager, StringList& source_list);
 
 	static bool ReleaseTexture(RenderManager* render_manager, const String& texture_source);
 	static void ReleaseAllTextures(RenderManager* render_manager);
+	static void ReleaseInvalidatedTextures(RenderManager* render_manager);
 	static void ReleaseAllCompiledGeometry(RenderManager* render_manager);
 
 	friend class CompiledFilter;
 	friend class CompiledShader;
 	friend class CallbackTexture;
 	friend class Geometry;
+	friend class GlyphInstanceGeometry;
 	friend class Texture;
 
 	friend StringList Rml::GetTextureSourceList();
 	friend bool Rml::ReleaseTexture(const String&, RenderInterface*);
 	friend void Rml::ReleaseTextures(RenderInterface*);
 	friend void Rml::ReleaseCompiledGeometry(RenderInterface*);
+	friend void Rml::ReleaseFontResources();
 };
 
 } // namespace Rml
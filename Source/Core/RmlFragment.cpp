@@ -0,0 +1,153 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RmlFragment.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "XMLParseTools.h"
+
+namespace Rml {
+
+// Records the nodes found by the parser, without instancing anything.
+class XMLParserRecorder final : public XMLParser {
+public:
+	XMLParserRecorder(Vector<RmlFragment::Node>& nodes) : XMLParser(nullptr), nodes(nodes) {}
+
+protected:
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		nodes.push_back(RmlFragment::Node{RmlFragment::Node::Type::ElementStart, name, attributes, XMLDataType::Text});
+	}
+	void HandleElementEnd(const String& name) override
+	{
+		nodes.push_back(RmlFragment::Node{RmlFragment::Node::Type::ElementEnd, name, XMLAttributes(), XMLDataType::Text});
+	}
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		nodes.push_back(RmlFragment::Node{RmlFragment::Node::Type::Data, data, XMLAttributes(), type});
+	}
+
+private:
+	Vector<RmlFragment::Node>& nodes;
+};
+
+// Submits recorded nodes to the node handlers.
+class XMLParserReplayer final : public XMLParser {
+public:
+	XMLParserReplayer(Element* root) : XMLParser(root) {}
+
+	void Replay(const Vector<RmlFragment::Node>& nodes)
+	{
+		for (const RmlFragment::Node& node : nodes)
+		{
+			switch (node.type)
+			{
+			case RmlFragment::Node::Type::ElementStart: HandleElementStart(node.value, node.attributes); break;
+			case RmlFragment::Node::Type::ElementEnd: HandleElementEnd(node.value); break;
+			case RmlFragment::Node::Type::Data: HandleData(node.value, node.data_type); break;
+			}
+		}
+	}
+};
+
+RmlFragment::RmlFragment(String rml) : rml(std::move(rml)) {}
+
+RmlFragment::~RmlFragment() {}
+
+void RmlFragment::Instance(Element* parent)
+{
+	RMLUI_ASSERT(parent);
+
+	String translated_rml;
+	if (SystemInterface* system_interface = GetSystemInterface())
+		system_interface->TranslateString(translated_rml, rml);
+
+	Context* context = parent->GetContext();
+	const String base_tag = (context ? context->GetDocumentsBaseTag() : String("body"));
+
+	if (!recorded || translated_rml != recorded_translation || base_tag != recorded_base_tag)
+		Record(translated_rml, base_tag);
+
+	if (!parse_as_rml)
+	{
+		Factory::InstanceElementText(parent, rml);
+		return;
+	}
+
+	XMLParserReplayer parser(parent);
+	parser.Replay(nodes);
+}
+
+void RmlFragment::Record(const String& translated_rml, const String& base_tag)
+{
+	recorded = true;
+	recorded_translation = translated_rml;
+	recorded_base_tag = base_tag;
+	nodes.clear();
+
+	// Determine whether the contents need to be parsed the same way as the factory does when instancing text.
+	parse_as_rml = false;
+	bool inside_brackets = false;
+	bool inside_string = false;
+	char previous = 0;
+	for (const char c : translated_rml)
+	{
+		if (XMLParseTools::ParseDataBrackets(inside_brackets, inside_string, c, previous))
+		{
+			// Leave any errors to be reported when instancing the text.
+			parse_as_rml = false;
+			return;
+		}
+
+		if (!inside_brackets && c == '<')
+			parse_as_rml = true;
+
+		previous = c;
+	}
+
+	if (!parse_as_rml)
+		return;
+
+	const String open_tag = "<" + base_tag + ">";
+	const String close_tag = "</" + base_tag + ">";
+	StreamMemory stream(open_tag.size() + translated_rml.size() + close_tag.size());
+	stream.Write(open_tag);
+	stream.Write(translated_rml);
+	stream.Write(close_tag);
+	stream.Seek(0, SEEK_SET);
+
+	XMLParserRecorder parser(nodes);
+	parser.Parse(&stream);
+}
+
+} // namespace Rml
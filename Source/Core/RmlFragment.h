@@ -0,0 +1,82 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_RMLFRAGMENT_H
+#define RMLUI_CORE_RMLFRAGMENT_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+    A fragment of RML which is parsed once, and can then be instanced any number of times as the children of an element.
+
+    Instancing the fragment is equivalent to setting its RML as the inner RML of an empty element. The elements and data found by the parser
+    are recorded, and then submitted to the node handlers in the same way as during parsing, only the tokenization of the RML is skipped.
+ */
+
+class RmlFragment : NonCopyMoveable {
+public:
+	RmlFragment(String rml);
+	~RmlFragment();
+
+	/// Instances the fragment, appending its contents to the children of the given element.
+	/// @param[in] parent The element to instance the fragment into.
+	void Instance(Element* parent);
+
+	/// A node encountered by the parser.
+	struct Node {
+		enum class Type { ElementStart, ElementEnd, Data };
+		Type type;
+		// The tag name for elements, or the data contents.
+		String value;
+		XMLAttributes attributes;
+		XMLDataType data_type;
+	};
+
+private:
+	void Record(const String& translated_rml, const String& base_tag);
+
+	String rml;
+
+	// The fragment is recorded again if the translation of the RML or the document base tag changes.
+	bool recorded = false;
+	String recorded_translation;
+	String recorded_base_tag;
+
+	// Fragments without any elements are instanced directly as text.
+	bool parse_as_rml = false;
+	Vector<Node> nodes;
+};
+
+} // namespace Rml
+#endif
@@ -34,9 +34,16 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "StyleSheetInvalidationSets.h"
 #include "StyleSheetNode.h"
 #include <algorithm>
 
+#ifdef RMLUI_STYLESHEET_MATCHING_STATISTICS
+	#define RMLUI_MATCHING_STATISTIC(counter) matching_statistics.counter += 1
+#else
+	#define RMLUI_MATCHING_STATISTIC(counter)
+#endif
+
 namespace Rml {
 
 StyleSheet::StyleSheet()
@@ -94,7 +101,14 @@ void StyleSheet::BuildNodeIndex()
 {
 	RMLUI_ZoneScoped;
 	styled_node_index = {};
-	root->BuildIndex(styled_node_index);
+
+	// Count the class names first, so that each node can be indexed by its most selective class.
+	UnorderedMap<String, int> class_counts;
+	root->CountClassNames(class_counts);
+	root->BuildIndex(styled_node_index, class_counts);
+
+	invalidation_sets = MakeUnique<StyleSheetInvalidationSets>();
+	root->BuildInvalidationSets(*invalidation_sets);
 }
 
 const NamedDecorator* StyleSheet::GetNamedDecorator(const String& name) const
@@ -190,7 +204,7 @@ const Sprite* StyleSheet::GetSprite(const String& name) const
 	return spritesheet_list.GetSprite(name);
 }
 
-SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element) const
+SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Element* element, bool* out_shareable_with_siblings) const
 {
 	RMLUI_ASSERT_NONRECURSIVE;
 
@@ -198,32 +212,57 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	static Vector<const StyleSheetNode*> applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
-		if (it_nodes != node_index.end())
-		{
-			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
-
-			for (const StyleSheetNode* node : nodes)
-			{
-				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
-				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
-				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
-					applicable_nodes.push_back(node);
-			}
-		}
-	};
+	// The names of all the element's ancestors, used to quickly rule out nodes before matching them against the element's hierarchy.
+	const AncestorFilter& ancestor_filter = element->GetStyle()->GetAncestorFilter();
+
+	// Keep track of whether any of the tested nodes might apply differently to our siblings.
+	bool depends_on_siblings = false;
 
 	// See if there are any styles defined for this element.
 	const String& tag = element->GetTagName();
 	const String& id = element->GetId();
 	const StringList& class_names = element->GetStyle()->GetClassNameList();
 
+	if (out_shareable_with_siblings)
+		*out_shareable_with_siblings = false;
+
 	// Text elements are never matched.
 	if (tag == "#text")
 		return nullptr;
 
+	// The element's own names, used to rule out nodes requiring names not present on the element, in addition to the one they were indexed by.
+	AncestorFilter element_filter;
+	element_filter.AddElement(tag, id, class_names);
+
+	RMLUI_MATCHING_STATISTIC(num_lookups);
+
+	auto TestNode = [&](const StyleSheetNode* node) {
+		RMLUI_MATCHING_STATISTIC(num_candidate_nodes);
+
+		// Now see if we satisfy the remaining requirements of the node, including all ancestor nodes. What this involves is traversing the style
+		// nodes backwards, trying to match nodes in the element's hierarchy to nodes in the style hierarchy.
+		if (!node->MayBeApplicable(ancestor_filter, element_filter))
+			return;
+
+		RMLUI_MATCHING_STATISTIC(num_tested_nodes);
+		depends_on_siblings |= node->CanDifferBetweenSiblings();
+		if (node->IsApplicable(element))
+		{
+			RMLUI_MATCHING_STATISTIC(num_matched_nodes);
+			applicable_nodes.push_back(node);
+		}
+	};
+
+	auto AddApplicableNodes = [&TestNode](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
+		auto it_nodes = node_index.find(Hash<String>()(key));
+		if (it_nodes != node_index.end())
+		{
+			// We found nodes that have at least one requirement matching the element.
+			for (const StyleSheetNode* node : it_nodes->second)
+				TestNode(node);
+		}
+	};
+
 	// First, look up the indexed requirements.
 	if (!id.empty())
 		AddApplicableNodes(styled_node_index.ids, id);
@@ -235,10 +274,10 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 
 	// Also check all remaining nodes that don't contain any indexed requirements.
 	for (const StyleSheetNode* node : styled_node_index.other)
-	{
-		if (node->IsApplicable(element))
-			applicable_nodes.push_back(node);
-	}
+		TestNode(node);
+
+	if (out_shareable_with_siblings)
+		*out_shareable_with_siblings = !depends_on_siblings;
 
 	// If this element definition won't actually store any information, don't bother with it.
 	if (applicable_nodes.empty())
@@ -264,4 +303,20 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	return definition;
 }
 
+const StyleSheetInvalidationSets& StyleSheet::GetInvalidationSets() const
+{
+	RMLUI_ASSERT(invalidation_sets);
+	return *invalidation_sets;
+}
+
+const StyleSheet::MatchingStatistics& StyleSheet::GetMatchingStatistics() const
+{
+	return matching_statistics;
+}
+
+void StyleSheet::ResetMatchingStatistics()
+{
+	matching_statistics = {};
+}
+
 } // namespace Rml
@@ -0,0 +1,123 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STYLESHEETINVALIDATIONSETS_H
+#define RMLUI_CORE_STYLESHEETINVALIDATIONSETS_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
+
+namespace Rml {
+
+/**
+    Flags describing which elements may change their definition when a name, such as a class or pseudo class, is set or removed on an element.
+ */
+enum class InvalidationFlags : uint8_t {
+	None = 0,
+	Self = 1 << 0,        // The element itself.
+	Descendants = 1 << 1, // All descendants of the element.
+	Siblings = 1 << 2,    // All siblings of the element and their descendants.
+	All = Self | Descendants | Siblings,
+};
+inline InvalidationFlags operator|(InvalidationFlags lhs, InvalidationFlags rhs)
+{
+	return InvalidationFlags(uint8_t(lhs) | uint8_t(rhs));
+}
+inline InvalidationFlags& operator|=(InvalidationFlags& lhs, InvalidationFlags rhs)
+{
+	return lhs = lhs | rhs;
+}
+inline bool operator&(InvalidationFlags lhs, InvalidationFlags rhs)
+{
+	return (uint8_t(lhs) & uint8_t(rhs)) != 0;
+}
+
+/**
+    StyleSheetInvalidationSets maps each name used in the selectors of a style sheet to the elements affected by changes to the name, as determined
+    by the position of the name in the selectors. Names not used by any selector do not affect any elements.
+
+    Each name is further qualified by the other tag, id, and class names required by the same compound selector. Thus, a pseudo class used with a
+    sibling combinator in one specific selector, such as 'slidertrack:hover + sliderbar', only affects the siblings of matching elements.
+ */
+class StyleSheetInvalidationSets {
+public:
+	enum NameType { Id, Class, PseudoClass, Attribute, NumNameTypes };
+
+	/// Adds a name used in a compound selector.
+	/// @param[in] compound_names The filter of tag, id, and class names required by the compound selector.
+	/// @param[in] flags The elements affected by changes to the name.
+	void Add(NameType type, const String& name, const AncestorFilter& compound_names, InvalidationFlags flags)
+	{
+		if (flags == InvalidationFlags::None)
+			return;
+
+		Vector<Entry>& entries = name_maps[type][name];
+		for (Entry& entry : entries)
+		{
+			if (entry.compound_names == compound_names)
+			{
+				entry.flags |= flags;
+				return;
+			}
+		}
+		entries.push_back(Entry{compound_names, flags});
+	}
+
+	/// Returns true if the name is used in any selector.
+	bool Contains(NameType type, const String& name) const { return name_maps[type].count(name) == 1; }
+
+	/// Returns the elements affected by changes to the given name on an element.
+	/// @param[in] element_names The filter of the element's own tag, id, and class names, including the given name if it is an id or a class.
+	InvalidationFlags Get(NameType type, const String& name, const AncestorFilter& element_names) const
+	{
+		InvalidationFlags result = InvalidationFlags::None;
+
+		auto it = name_maps[type].find(name);
+		if (it == name_maps[type].end())
+			return result;
+
+		for (const Entry& entry : it->second)
+		{
+			if (element_names.MayContain(entry.compound_names))
+				result |= entry.flags;
+		}
+
+		return result;
+	}
+
+private:
+	struct Entry {
+		AncestorFilter compound_names;
+		InvalidationFlags flags;
+	};
+
+	UnorderedMap<String, Vector<Entry>> name_maps[NumNameTypes];
+};
+
+} // namespace Rml
+#endif
@@ -33,6 +33,7 @@
 #include "StyleSheetFactory.h"
 #include "StyleSheetSelector.h"
 #include <algorithm>
+#include <limits.h>
 #include <tuple>
 
 namespace Rml {
@@ -50,11 +51,13 @@ StyleSheetNode::StyleSheetNode()
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const CompoundSelector& selector) : parent(parent), selector(selector)
 {
 	CalculateAndSetSpecificity();
+	CalculateRequiredNames();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, CompoundSelector&& selector) : parent(parent), selector(std::move(selector))
 {
 	CalculateAndSetSpecificity();
+	CalculateRequiredNames();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const CompoundSelector& other)
@@ -124,7 +127,19 @@ UniquePtr<StyleSheetNode> StyleSheetNode::DeepCopy(StyleSheetNode* in_parent) co
 	return node;
 }
 
-void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
+void StyleSheetNode::CountClassNames(UnorderedMap<String, int>& class_counts) const
+{
+	if (properties.GetNumProperties() > 0)
+	{
+		for (const String& name : selector.class_names)
+			class_counts[name] += 1;
+	}
+
+	for (auto& child : children)
+		child->CountClassNames(class_counts);
+}
+
+void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index, const UnorderedMap<String, int>& class_counts) const
 {
 	// If this has properties defined, then we insert it into the styled node index.
 	if (properties.GetNumProperties() > 0)
@@ -144,9 +159,22 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		}
 		else if (!selector.class_names.empty())
 		{
-			// @performance Right now we just use the first class for simplicity. Later we may want to devise a better strategy to try to add the
-			// class with the most unique name. For example by adding the class from this node's list that has the fewest existing matches.
-			IndexInsertNode(styled_node_index.classes, selector.class_names.front(), this);
+			// Use the class required by the fewest styled nodes. Common utility classes would otherwise gather large buckets of nodes which
+			// need to be tested against every element using that class.
+			const String* most_selective_class = &selector.class_names.front();
+			int min_count = INT_MAX;
+			for (const String& name : selector.class_names)
+			{
+				auto it = class_counts.find(name);
+				const int count = (it != class_counts.end() ? it->second : 0);
+				if (count < min_count)
+				{
+					most_selective_class = &name;
+					min_count = count;
+				}
+			}
+
+			IndexInsertNode(styled_node_index.classes, *most_selective_class, this);
 		}
 		else if (!selector.tag.empty())
 		{
@@ -159,7 +187,31 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 	}
 
 	for (auto& child : children)
-		child->BuildIndex(styled_node_index);
+		child->BuildIndex(styled_node_index, class_counts);
+}
+
+void StyleSheetNode::BuildInvalidationSets(StyleSheetInvalidationSets& invalidation_sets) const
+{
+	if (parent)
+	{
+		// Changes to our names affect the element itself when this node ends a styled selector, and otherwise the elements matched by the selector
+		// continuing from this node in relation to this node's element.
+		InvalidationFlags flags = InvalidationFlags::None;
+		if (properties.GetNumProperties() > 0)
+			flags |= InvalidationFlags::Self;
+
+		for (const auto& child : children)
+		{
+			const SelectorCombinator combinator = child->selector.combinator;
+			const bool sibling_combinator = (combinator == SelectorCombinator::NextSibling || combinator == SelectorCombinator::SubsequentSibling);
+			flags |= (sibling_combinator ? InvalidationFlags::Siblings : InvalidationFlags::Descendants);
+		}
+
+		AddInvalidationNames(invalidation_sets, flags);
+	}
+
+	for (const auto& child : children)
+		child->BuildInvalidationSets(invalidation_sets);
 }
 
 int StyleSheetNode::GetSpecificity() const
@@ -355,6 +407,19 @@ bool StyleSheetNode::TraverseMatch(const Element* element) const
 	return false;
 }
 
+bool StyleSheetNode::MayBeApplicable(const AncestorFilter& ancestor_filter, const AncestorFilter& element_filter) const
+{
+	return element_filter.MayContain(required_names) && ancestor_filter.MayContain(required_ancestor_names);
+}
+
+bool StyleSheetNode::CanDifferBetweenSiblings() const
+{
+	// Any nodes further up the tree after a descendant or child combinator are matched against the element's ancestors, which are shared with
+	// its siblings.
+	const bool sibling_combinator = (selector.combinator == SelectorCombinator::NextSibling || selector.combinator == SelectorCombinator::SubsequentSibling);
+	return !selector.attributes.empty() || !selector.structural_selectors.empty() || (sibling_combinator && parent && parent->parent);
+}
+
 bool StyleSheetNode::IsApplicable(const Element* element) const
 {
 	// Determine whether the element matches the current node and its entire lineage. The entire hierarchy of the element's document will be
@@ -417,4 +482,62 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateRequiredNames()
+{
+	auto AddNames = [](AncestorFilter& filter, const CompoundSelector& compound_selector) {
+		if (!compound_selector.tag.empty())
+			filter.Add(AncestorFilter::NameType::Tag, compound_selector.tag);
+		if (!compound_selector.id.empty())
+			filter.Add(AncestorFilter::NameType::Id, compound_selector.id);
+		for (const String& name : compound_selector.class_names)
+			filter.Add(AncestorFilter::NameType::Class, name);
+	};
+
+	AddNames(required_names, selector);
+
+	if (!parent)
+		return;
+
+	// The parent node is matched against an ancestor of the element when we have a descendant or child combinator, otherwise against one of
+	// its siblings. In both cases, any ancestors required by the parent node are also ancestors of the element.
+	required_ancestor_names = parent->required_ancestor_names;
+
+	const bool parent_is_ancestor = (selector.combinator == SelectorCombinator::Descendant || selector.combinator == SelectorCombinator::Child);
+	if (parent_is_ancestor && parent->parent)
+		AddNames(required_ancestor_names, parent->selector);
+}
+
+void StyleSheetNode::AddInvalidationNames(StyleSheetInvalidationSets& invalidation_sets, InvalidationFlags flags) const
+{
+	if (flags == InvalidationFlags::None)
+		return;
+
+	if (!selector.id.empty())
+		invalidation_sets.Add(StyleSheetInvalidationSets::Id, selector.id, required_names, flags);
+	for (const String& name : selector.class_names)
+		invalidation_sets.Add(StyleSheetInvalidationSets::Class, name, required_names, flags);
+	for (const String& name : selector.pseudo_class_names)
+		invalidation_sets.Add(StyleSheetInvalidationSets::PseudoClass, name, required_names, flags);
+	for (const AttributeSelector& attribute : selector.attributes)
+		invalidation_sets.Add(StyleSheetInvalidationSets::Attribute, attribute.name, required_names, flags);
+
+	for (const StructuralSelector& structural_selector : selector.structural_selectors)
+	{
+		if (structural_selector.selector_tree)
+			structural_selector.selector_tree->root->AddNestedInvalidationNames(invalidation_sets, flags);
+	}
+}
+
+void StyleSheetNode::AddNestedInvalidationNames(StyleSheetInvalidationSets& invalidation_sets, InvalidationFlags flags) const
+{
+	// The leaf nodes of nested selectors, such as in ':not(.a)', are matched against the same element as the outer node. Other nested nodes are
+	// matched against its relatives, for simplicity we consider them to affect all elements. In both cases we only qualify the names by the
+	// nested node's own required names, which is conservative.
+	for (const auto& child : children)
+	{
+		child->AddInvalidationNames(invalidation_sets, child->children.empty() ? flags : InvalidationFlags::All);
+		child->AddNestedInvalidationNames(invalidation_sets, flags);
+	}
+}
+
 } // namespace Rml
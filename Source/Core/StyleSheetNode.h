@@ -31,6 +31,8 @@
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
+#include "StyleSheetInvalidationSets.h"
 #include "StyleSheetSelector.h"
 
 namespace Rml {
@@ -60,8 +62,14 @@ public:
 	void MergeHierarchy(StyleSheetNode* node, int specificity_offset = 0);
 	/// Copy this node including all descendent nodes.
 	UniquePtr<StyleSheetNode> DeepCopy(StyleSheetNode* parent = nullptr) const;
+	/// Counts the number of styled nodes requiring each class name, recursively.
+	void CountClassNames(UnorderedMap<String, int>& class_counts) const;
 	/// Builds up a style sheet's index recursively.
-	void BuildIndex(StyleSheetIndex& styled_node_index) const;
+	/// @param[in] class_counts The number of styled nodes requiring each class name, used to index nodes by their most selective class.
+	void BuildIndex(StyleSheetIndex& styled_node_index, const UnorderedMap<String, int>& class_counts) const;
+
+	/// Adds the names used in the selectors of this node and its descendants to the invalidation sets, recursively.
+	void BuildInvalidationSets(StyleSheetInvalidationSets& invalidation_sets) const;
 
 	/// Imports properties from a single rule definition into the node's properties and sets the appropriate specificity on them. Any existing
 	/// attributes sharing a key with a new attribute will be overwritten if they are of a lower specificity.
@@ -75,12 +83,25 @@ public:
 	/// @note For performance reasons this call does not check whether 'element' is a text element. The caller must manually check this condition and
 	/// consider any text element not applicable.
 	bool IsApplicable(const Element* element) const;
+	/// Returns false if the names required of the element by this node, or of its ancestors by this node and its parents, can not be found in the
+	/// given filters, in which case the node is never applicable to the element. Otherwise, the node must be tested further.
+	/// @param[in] ancestor_filter The filter of names of the element's ancestors.
+	/// @param[in] element_filter The filter of the element's own tag, id, and class names.
+	bool MayBeApplicable(const AncestorFilter& ancestor_filter, const AncestorFilter& element_filter) const;
+	/// Returns true if this node may apply differently to siblings sharing the same tag, id, classes, pseudo classes, and thereby ancestors.
+	/// That is, when it contains attribute or structural selectors, or the sibling combinator.
+	bool CanDifferBetweenSiblings() const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
 
 private:
 	void CalculateAndSetSpecificity();
+	void CalculateRequiredNames();
+	// Adds the names of this node's selector to the invalidation sets with the given flags, including names of any nested selectors.
+	void AddInvalidationNames(StyleSheetInvalidationSets& invalidation_sets, InvalidationFlags flags) const;
+	// Adds the names of the nodes in a nested selector tree, given the flags of the node containing the nested selector.
+	void AddNestedInvalidationNames(StyleSheetInvalidationSets& invalidation_sets, InvalidationFlags flags) const;
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
@@ -99,6 +120,11 @@ private:
 	// A measure of specificity of this node; the attribute in a node with a higher value will override those of a node with a lower value.
 	int specificity = 0;
 
+	// The names that must be present in the element's ancestors for this node to be applicable, due to descendant and child combinators.
+	AncestorFilter required_ancestor_names;
+	// The tag, id, and class names that must be present on the element itself for this node to be applicable.
+	AncestorFilter required_names;
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
@@ -0,0 +1,113 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextGeometryCache.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+
+namespace Rml {
+
+// Only one geometry is cached per hash, in the rare case of a collision the newer geometry is simply not shared.
+static UnorderedMap<size_t, WeakPtr<TextGeometry>> text_geometry_map;
+
+static size_t HashKey(const TextGeometryKey& key)
+{
+	size_t hash = 0;
+	Utilities::HashCombine(hash, key.render_manager);
+	Utilities::HashCombine(hash, key.font_face_handle);
+	Utilities::HashCombine(hash, key.font_effects_handle);
+	Utilities::HashCombine(hash, key.font_handle_version);
+	Utilities::HashCombine(hash, key.language);
+	Utilities::HashCombine(hash, int(key.direction));
+	Utilities::HashCombine(hash, key.letter_spacing);
+	Utilities::HashCombine(hash, key.glyph_instancing);
+	Utilities::HashCombine(hash, uint32_t(key.colour.red) | uint32_t(key.colour.green) << 8 | uint32_t(key.colour.blue) << 16 |
+			uint32_t(key.colour.alpha) << 24);
+	Utilities::HashCombine(hash, key.opacity);
+	for (const TextGeometryLine& line : key.lines)
+	{
+		Utilities::HashCombine(hash, line.text);
+		Utilities::HashCombine(hash, line.position.x);
+		Utilities::HashCombine(hash, line.position.y);
+	}
+	return hash;
+}
+
+bool operator==(const TextGeometryLine& a, const TextGeometryLine& b)
+{
+	return a.text == b.text && a.position == b.position;
+}
+
+bool operator==(const TextGeometryKey& a, const TextGeometryKey& b)
+{
+	return a.render_manager == b.render_manager && a.font_face_handle == b.font_face_handle && a.font_effects_handle == b.font_effects_handle &&
+		a.font_handle_version == b.font_handle_version && a.language == b.language && a.direction == b.direction &&
+		a.letter_spacing == b.letter_spacing && a.glyph_instancing == b.glyph_instancing && a.colour == b.colour && a.opacity == b.opacity &&
+		a.lines == b.lines;
+}
+
+TextGeometry::~TextGeometry()
+{
+	if (cached)
+		TextGeometryCache::Remove(this);
+}
+
+SharedPtr<TextGeometry> TextGeometryCache::Find(const TextGeometryKey& key)
+{
+	auto it = text_geometry_map.find(HashKey(key));
+	if (it == text_geometry_map.end())
+		return nullptr;
+
+	SharedPtr<TextGeometry> text_geometry = it->second.lock();
+	if (!text_geometry || !(text_geometry->key == key))
+		return nullptr;
+
+	return text_geometry;
+}
+
+void TextGeometryCache::Insert(const SharedPtr<TextGeometry>& text_geometry)
+{
+	RMLUI_ASSERT(text_geometry && !text_geometry->cached);
+	text_geometry->hash = HashKey(text_geometry->key);
+
+	auto result = text_geometry_map.emplace(text_geometry->hash, text_geometry);
+	text_geometry->cached = result.second;
+}
+
+int TextGeometryCache::GetNumEntries()
+{
+	return (int)text_geometry_map.size();
+}
+
+void TextGeometryCache::Remove(TextGeometry* text_geometry)
+{
+	RMLUI_ASSERT(text_geometry_map.find(text_geometry->hash) != text_geometry_map.end());
+	text_geometry_map.erase(text_geometry->hash);
+	text_geometry->cached = false;
+}
+
+} // namespace Rml
@@ -0,0 +1,123 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTGEOMETRYCACHE_H
+#define RMLUI_CORE_TEXTGEOMETRYCACHE_H
+
+#include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/StyleTypes.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class RenderManager;
+
+struct TextGeometryLine {
+	String text;
+	Vector2f position;
+};
+
+/**
+    Everything the generated geometry of a text element depends on.
+
+    The colour and opacity are only part of the key for regular geometry, glyph instances are coloured while rendering.
+ */
+struct TextGeometryKey {
+	RenderManager* render_manager = nullptr;
+	FontFaceHandle font_face_handle = 0;
+	FontEffectsHandle font_effects_handle = 0;
+	int font_handle_version = 0;
+	String language;
+	Style::Direction direction = Style::Direction::Auto;
+	float letter_spacing = 0.f;
+	bool glyph_instancing = false;
+	ColourbPremultiplied colour;
+	float opacity = 0.f;
+	Vector<TextGeometryLine> lines;
+};
+
+bool operator==(const TextGeometryLine& a, const TextGeometryLine& b);
+bool operator==(const TextGeometryKey& a, const TextGeometryKey& b);
+
+/**
+    The generated geometry of a text element, shared between text elements with equal keys.
+ */
+struct TextGeometry : NonCopyMoveable {
+	TextGeometry(TextGeometryKey key) : key(std::move(key)) {}
+	~TextGeometry();
+
+	TextGeometryKey key;
+
+	// The width of each line, in the same order as the lines of the key.
+	Vector<int> line_widths;
+
+	struct TexturedGeometry {
+		Geometry geometry;
+		Texture texture;
+	};
+	Vector<TexturedGeometry> geometry;
+
+	struct TexturedGlyphInstanceGeometry {
+		GlyphInstanceGeometry geometry;
+		Texture texture;
+		GlyphTint tint;
+	};
+	// The glyph instances used instead of the above geometry when supported, their colour is applied while rendering.
+	Vector<TexturedGlyphInstanceGeometry> glyph_instances;
+
+private:
+	size_t hash = 0;
+	bool cached = false;
+	friend class TextGeometryCache;
+};
+
+/**
+    Shares the generated geometry of text elements with identical text, line positions, and font configuration.
+
+    Repetitive documents, such as data-bound lists, often render the same strings many times. Instead of generating and
+    storing the same geometry for each of them, text elements look up their geometry here before generating it. The
+    geometry is reference counted by the elements using it, and removed from the cache when the last one releases it.
+*/
+class TextGeometryCache {
+public:
+	/// Returns the cached geometry matching the given key, or nullptr if there is none.
+	static SharedPtr<TextGeometry> Find(const TextGeometryKey& key);
+
+	/// Adds newly generated geometry to the cache, to be shared with other text elements.
+	static void Insert(const SharedPtr<TextGeometry>& text_geometry);
+
+	/// Returns the number of cached text geometries.
+	static int GetNumEntries();
+
+private:
+	static void Remove(TextGeometry* text_geometry);
+	friend struct TextGeometry;
+};
+
+} // namespace Rml
+#endif
@@ -61,6 +61,15 @@ void CallbackTextureDatabase::ReleaseTexture(RenderInterface* render_interface,
 	texture_list.erase(callback_index);
 }
 
+TextureHandle CallbackTextureDatabase::InvalidateTexture(StableVectorIndex callback_index)
+{
+	CallbackTextureEntry& data = texture_list[callback_index];
+	const TextureHandle texture_handle = data.texture_handle;
+	data.texture_handle = {};
+	data.dimensions = {};
+	return texture_handle;
+}
+
 Vector2i CallbackTextureDatabase::GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index)
 {
 	return EnsureLoaded(render_manager, render_interface, callback_index).dimensions;
@@ -71,6 +80,11 @@ TextureHandle CallbackTextureDatabase::GetHandle(RenderManager* render_manager,
 	return EnsureLoaded(render_manager, render_interface, callback_index).texture_handle;
 }
 
+bool CallbackTextureDatabase::IsLoaded(StableVectorIndex callback_index) const
+{
+	return texture_list[callback_index].texture_handle != TextureHandle{};
+}
+
 auto CallbackTextureDatabase::EnsureLoaded(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index)
 	-> CallbackTextureEntry&
 {
@@ -44,9 +44,14 @@ public:
 
 	StableVectorIndex CreateTexture(CallbackTextureFunction&& callback);
 	void ReleaseTexture(RenderInterface* render_interface, StableVectorIndex callback_index);
+	// Detaches the generated texture while keeping the callback, so that the texture is regenerated on next use. Returns the
+	// detached texture handle, if any, which the caller becomes responsible for releasing.
+	TextureHandle InvalidateTexture(StableVectorIndex callback_index);
 
 	Vector2i GetDimensions(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
 	TextureHandle GetHandle(RenderManager* render_manager, RenderInterface* render_interface, StableVectorIndex callback_index);
+	// Returns true if the texture has been generated, thus it can be used without calling the callback.
+	bool IsLoaded(StableVectorIndex callback_index) const;
 
 	size_t size() const;
 
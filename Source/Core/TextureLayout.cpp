@@ -95,4 +95,22 @@ bool TextureLayout::GenerateLayout(int max_texture_dimensions)
 	return true;
 }
 
+Vector<byte> TextureLayout::AllocateTexture(int index)
+{
+	TextureLayoutTexture& texture = GetTexture(index);
+	Vector<byte> texture_data = texture.AllocateTexture();
+	const int stride = texture.GetDimensions().x * 4;
+
+	if (!texture_data.empty())
+	{
+		for (TextureLayoutRectangle& rectangle : rectangles)
+		{
+			if (rectangle.GetTextureIndex() == index)
+				rectangle.Allocate(texture_data.data(), stride);
+		}
+	}
+
+	return texture_data;
+}
+
 } // namespace Rml
@@ -73,6 +73,11 @@ public:
 	/// @return True if the layout was generated successfully, false if not.
 	bool GenerateLayout(int max_texture_dimensions);
 
+	/// Allocates the data for one of the layout's textures, and assigns it to the rectangles placed on the texture.
+	/// @param[in] index The index of the texture to allocate.
+	/// @return The allocated texture data.
+	Vector<byte> AllocateTexture(int index);
+
 private:
 	using RectangleList = Vector<TextureLayoutRectangle>;
 	using TextureList = Vector<TextureLayoutTexture>;
@@ -34,13 +34,14 @@ namespace Rml {
 TextureLayoutRow::TextureLayoutRow()
 {
 	height = 0;
+	width = 0;
 }
 
 TextureLayoutRow::~TextureLayoutRow() {}
 
 int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 {
-	int width = 1;
+	width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
@@ -82,15 +83,14 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 	return placed_rectangles;
 }
 
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+int TextureLayoutRow::GetHeight() const
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+	return height;
 }
 
-int TextureLayoutRow::GetHeight() const
+int TextureLayoutRow::GetWidth() const
 {
-	return height;
+	return width;
 }
 
 void TextureLayoutRow::Unplace()
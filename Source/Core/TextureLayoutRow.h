@@ -53,14 +53,12 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int width, int y);
 
-	/// Assigns allocated texture data to all rectangles in this row.
-	/// @param[in] texture_data The pointer to the beginning of the texture's data.
-	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
-
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
+	/// Returns the width of the row occupied by its rectangles, including padding.
+	/// @return The row's occupied width.
+	int GetWidth() const;
 
 	/// Resets the placed status for all of the rectangles within this row.
 	void Unplace();
@@ -69,6 +67,7 @@ private:
 	using RectangleList = Vector<TextureLayoutRectangle*>;
 
 	int height;
+	int width;
 	RectangleList rectangles;
 };
 
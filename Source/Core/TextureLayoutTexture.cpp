@@ -34,6 +34,8 @@ namespace Rml {
 
 TextureLayoutTexture::TextureLayoutTexture() : dimensions(0, 0) {}
 
+TextureLayoutTexture::TextureLayoutTexture(Vector2i dimensions) : dimensions(dimensions), used_height(1) {}
+
 TextureLayoutTexture::~TextureLayoutTexture()
 {
 	// Don't free texture data; freed in the texture loader.
@@ -77,11 +79,13 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 	// Now we're layout out the rectangles in the texture. If we don't fit all the rectangles on
 	// and have room to grow (ie, haven't hit the maximum texture size in both dimensions) then
 	// we'll have another go with a bigger texture.
+	Vector<TextureLayoutRow> rows;
 	int num_placed_rectangles = 0;
 	for (;;)
 	{
 		bool success = true;
 		int height = 1;
+		shelves.clear();
 
 		while (num_placed_rectangles != unplaced_rectangles)
 		{
@@ -93,8 +97,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 				break;
 			}
 
-			height += row.GetHeight() + 1;
-			if (height > dimensions.y)
+			if (height + row.GetHeight() + 1 > dimensions.y)
 			{
 				// D'oh! We've exceeded our height boundaries. This row should be unplaced.
 				row.Unplace();
@@ -102,10 +105,16 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 				break;
 			}
 
+			// Remember the free space left in the row, so that rectangles can be added to it later.
+			shelves.push_back(Shelf{height, row.GetHeight(), row.GetWidth()});
+			height += row.GetHeight() + 1;
+
 			rows.push_back(row);
 			num_placed_rectangles += row_size;
 		}
 
+		used_height = height;
+
 		// If the rectangles were successfully laid out within the texture limits, we're done.
 		if (success)
 			return num_placed_rectangles;
@@ -132,19 +141,59 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 	}
 }
 
+bool TextureLayoutTexture::Place(TextureLayoutRectangle& rectangle, int texture_index)
+{
+	const Vector2i rectangle_dimensions = rectangle.GetDimensions();
+	if (rectangle_dimensions.x + 2 > dimensions.x)
+		return false;
+
+	// Find the shelf with room for the rectangle that wastes the least height. The bottom shelf can also grow into the free space below it.
+	Shelf* best_shelf = nullptr;
+	for (Shelf& shelf : shelves)
+	{
+		const bool is_bottom_shelf = (&shelf == &shelves.back());
+		const int max_height = (is_bottom_shelf ? dimensions.y - 1 - shelf.y : shelf.height);
+		if (rectangle_dimensions.y > max_height || shelf.width + rectangle_dimensions.x + 1 > dimensions.x)
+			continue;
+
+		if (!best_shelf || Math::Max(shelf.height, rectangle_dimensions.y) < Math::Max(best_shelf->height, rectangle_dimensions.y))
+			best_shelf = &shelf;
+	}
+
+	if (!best_shelf)
+	{
+		// Open a new shelf below the existing ones.
+		if (used_height + rectangle_dimensions.y + 1 > dimensions.y)
+			return false;
+
+		shelves.push_back(Shelf{used_height, 0, 1});
+		best_shelf = &shelves.back();
+	}
+
+	if (rectangle_dimensions.y > best_shelf->height)
+	{
+		RMLUI_ASSERT(best_shelf == &shelves.back());
+		best_shelf->height = rectangle_dimensions.y;
+		used_height = best_shelf->y + best_shelf->height + 1;
+	}
+
+	rectangle.Place(texture_index, Vector2i(best_shelf->width, best_shelf->y));
+
+	// An extra pixel is added on so the rectangles aren't pushed up against each other, just like in the row layout.
+	if (rectangle_dimensions.x > 0)
+		best_shelf->width += rectangle_dimensions.x + 1;
+
+	return true;
+}
+
 Vector<byte> TextureLayoutTexture::AllocateTexture()
 {
 	Vector<byte> texture_data;
 
+	// Set the texture to transparent black.
 	if (dimensions.x > 0 && dimensions.y > 0)
-	{
-		// Set the texture to transparent black.
 		texture_data.resize(dimensions.x * dimensions.y * 4, 0);
 
-		for (size_t i = 0; i < rows.size(); ++i)
-			rows[i].Allocate(texture_data.data(), dimensions.x * 4);
-	}
-
 	return texture_data;
 }
 
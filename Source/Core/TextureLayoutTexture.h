@@ -46,6 +46,9 @@ class TextureLayout;
 class TextureLayoutTexture {
 public:
 	TextureLayoutTexture();
+	/// Constructs an empty texture of fixed dimensions, for placing rectangles into one at a time.
+	/// @param[in] dimensions The dimensions of the texture.
+	explicit TextureLayoutTexture(Vector2i dimensions);
 	~TextureLayoutTexture();
 
 	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
@@ -60,15 +63,29 @@ public:
 	/// @return The number of placed rectangles.
 	int Generate(TextureLayout& layout, int maximum_dimensions);
 
+	/// Attempts to place a rectangle in the free space of this texture, without moving any of the previously placed rectangles.
+	/// @param[in] rectangle The rectangle to place.
+	/// @param[in] texture_index The index of this texture within its layout.
+	/// @return True if the rectangle was placed, false if there is no room left for it.
+	bool Place(TextureLayoutRectangle& rectangle, int texture_index);
+
 	/// Allocates the texture.
 	/// @return The allocated texture data.
 	Vector<byte> AllocateTexture();
 
 private:
-	using RowList = Vector<TextureLayoutRow>;
+	// A horizontal band of the texture, in which rectangles are placed from left to right.
+	struct Shelf {
+		int y;
+		int height;
+		int width;
+	};
+	using ShelfList = Vector<Shelf>;
 
 	Vector2i dimensions;
-	RowList rows;
+	ShelfList shelves;
+	// The height of the texture occupied by shelves, including padding.
+	int used_height = 0;
 };
 
 } // namespace Rml
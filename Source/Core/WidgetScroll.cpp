@@ -168,6 +168,8 @@ void WidgetScroll::Update()
 
 			if (Context* ctx = parent->GetContext())
 				ctx->RequestNextUpdate(arrow_timers[i]);
+
+			DirtyScrolledElementUpdate();
 		}
 	}
 }
@@ -432,12 +434,14 @@ void WidgetScroll::ProcessEvent(Event& event)
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
 			ScrollLineUp();
+			DirtyScrolledElementUpdate();
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
 			last_update_time = Clock::GetElapsedTime();
 			ScrollLineDown();
+			DirtyScrolledElementUpdate();
 		}
 	}
 	else if (event == EventId::Mouseup || event == EventId::Mouseout)
@@ -449,6 +453,12 @@ void WidgetScroll::ProcessEvent(Event& event)
 	}
 }
 
+void WidgetScroll::DirtyScrolledElementUpdate()
+{
+	if (Element* scrolled_element = parent->GetParentNode())
+		scrolled_element->DirtyUpdate();
+}
+
 void WidgetScroll::PositionBar()
 {
 	const Vector2f track_dimensions = track->GetBox().GetSize();
@@ -95,6 +95,9 @@ private:
 	// Set the offset on 'bar' based on its position.
 	void PositionBar();
 
+	// Ensures that the scrolled element is updated, which in turn updates this widget while the arrows are held down.
+	void DirtyScrolledElementUpdate();
+
 	void ScrollLineDown();
 	void ScrollLineUp();
 	void ScrollPageDown();
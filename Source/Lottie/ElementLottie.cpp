@@ -59,6 +59,9 @@ bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 
 void ElementLottie::OnUpdate()
 {
+	// Keep updating to advance the animation.
+	DirtyUpdate();
+
 	if (animation_dirty)
 		LoadAnimation();
 
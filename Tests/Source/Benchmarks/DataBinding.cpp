@@ -31,6 +31,7 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <algorithm>
 #include <doctest.h>
 #include <nanobench.h>
 
@@ -245,3 +246,374 @@ TEST_CASE("data_binding")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String list_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window
+		{
+			left: 50px;
+			right: 50px;
+			top: 30px;
+			bottom: 30px;
+			max-width: -1px;
+			max-height: -1px;
+		}
+		/* Rows are layout boundaries, so that changing one row does not affect the layout of the others. */
+		.row
+		{
+			width: 400px;
+			height: 20px;
+			overflow: hidden;
+		}
+	</style>
+</head>
+
+<body template="window">
+<div data-model="list">
+<div class="row" data-for="item : items" data-class-big="item.value > 75">
+	<span>{{ item.name }}</span>
+	<span data-attr-title="item.name">{{ item.value }}</span>
+	<span data-if="item.value > 50">big</span>
+</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.list")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Item {
+		String name;
+		int value;
+	};
+	Vector<Item> items(2000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = Item{"item " + ToString(i), i % 100};
+
+	DataModelConstructor constructor = context->CreateDataModel("list");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<Item>())
+	{
+		handle.RegisterMember("name", &Item::name);
+		handle.RegisterMember("value", &Item::value);
+	}
+	constructor.RegisterArray<Vector<Item>>();
+	constructor.Bind("items", &items);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(list_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	nanobench::Rng rng;
+	nanobench::Bench bench;
+	bench.title("Data bindings: Change one entry of 2000");
+	bench.minEpochIterations(20);
+	bench.relative(true);
+
+	bench.run("Dirty variable", [&] {
+		const int index = (int)rng.bounded((uint32_t)items.size());
+		items[index].name = "item " + ToString(rng.bounded(1000));
+		model_handle.DirtyVariable("items");
+		context->Update();
+	});
+
+	bench.run("Dirty entry", [&] {
+		const int index = (int)rng.bounded((uint32_t)items.size());
+		items[index].name = "item " + ToString(rng.bounded(1000));
+		model_handle.DirtyVariable(DataAddress{"items", index});
+		context->Update();
+	});
+
+	bench.run("Dirty member", [&] {
+		const int index = (int)rng.bounded((uint32_t)items.size());
+		items[index].name = "item " + ToString(rng.bounded(1000));
+		model_handle.DirtyVariable(DataAddress{"items", index, "name"});
+		context->Update();
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static String GetTableDocumentRml(const String& row_attributes)
+{
+	return R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window
+		{
+			left: 50px;
+			right: 50px;
+			top: 30px;
+			bottom: 30px;
+			max-width: -1px;
+			max-height: -1px;
+		}
+		.row
+		{
+			width: 400px;
+			height: 20px;
+			overflow: hidden;
+		}
+	</style>
+</head>
+
+<body template="window">
+<div data-model="table">
+<div class="row" data-for="item : items" )" +
+		row_attributes + R"(>
+	<span>{{ item.name }}</span>
+	<span>{{ item.value }}</span>
+</div>
+</div>
+</body>
+</rml>
+)";
+}
+
+TEST_CASE("data_binding.sorted_table")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Item {
+		int id;
+		String name;
+		int value;
+	};
+	Vector<Item> items;
+
+	DataModelConstructor constructor = context->CreateDataModel("table");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<Item>())
+	{
+		handle.RegisterMember("id", &Item::id);
+		handle.RegisterMember("name", &Item::name);
+		handle.RegisterMember("value", &Item::value);
+	}
+	constructor.RegisterArray<Vector<Item>>();
+	constructor.Bind("items", &items);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: Table with 5000 rows");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+	bench.epochs(3).epochIterations(1);
+
+	int next_id = 0;
+	for (const String row_attributes : {"", "data-for-key=\"item.id\""})
+	{
+		const String name_suffix = (row_attributes.empty() ? "" : " (keyed)");
+
+		items.clear();
+		for (int i = 0; i < 5000; i++, next_id++)
+			items.push_back(Item{next_id, "item " + ToString(next_id), (next_id * 7919) % 5000});
+		model_handle.DirtyVariable("items");
+
+		ElementDocument* document = context->LoadDocumentFromMemory(GetTableDocumentRml(row_attributes));
+		REQUIRE(document);
+		document->Show();
+
+		context->Update();
+		context->Render();
+
+		bool ascending = false;
+		bench.run("Sort" + name_suffix, [&] {
+			ascending = !ascending;
+			std::sort(items.begin(), items.end(), [ascending](const Item& a, const Item& b) {
+				return ascending ? (a.value < b.value || (a.value == b.value && a.id < b.id))
+								 : (a.value > b.value || (a.value == b.value && a.id > b.id));
+			});
+			model_handle.DirtyVariable("items");
+			context->Update();
+			context->Render();
+		});
+
+		bool insert = false;
+		bench.run("Insert and remove at front" + name_suffix, [&] {
+			insert = !insert;
+			if (insert)
+			{
+				items.insert(items.begin(), Item{next_id, "item " + ToString(next_id), 0});
+				next_id++;
+			}
+			else
+				items.erase(items.begin());
+			model_handle.DirtyVariable("items");
+			context->Update();
+			context->Render();
+		});
+
+		document->Close();
+		context->Update();
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+static const String rows_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window
+		{
+			left: 50px;
+			right: 50px;
+			top: 30px;
+			bottom: 30px;
+			max-width: -1px;
+			max-height: -1px;
+		}
+	</style>
+</head>
+
+<body template="window">
+<div data-model="rows">
+<div class="row" data-for="item, i : items">
+	<span class="index" style="width: 30px; color: #aaa;">{{ i }}</span>
+	<span class="name" data-class-selected="item.selected">{{ item.name }}</span>
+	<input type="checkbox" data-checked="item.selected"/>
+	<button data-event-click="item.selected = !item.selected">Select</button>
+	<span data-if="item.value > 50" data-style-color="item.value > 75 ? 'red' : 'green'">{{ item.value | format(1) }}</span>
+</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.create_rows")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Item {
+		String name;
+		int value;
+		bool selected;
+	};
+	Vector<Item> items;
+
+	DataModelConstructor constructor = context->CreateDataModel("rows");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<Item>())
+	{
+		handle.RegisterMember("name", &Item::name);
+		handle.RegisterMember("value", &Item::value);
+		handle.RegisterMember("selected", &Item::selected);
+	}
+	constructor.RegisterArray<Vector<Item>>();
+	constructor.Bind("items", &items);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rows_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	constexpr int num_rows = 500;
+	Vector<Item> new_items(num_rows);
+	for (int i = 0; i < num_rows; i++)
+		new_items[i] = Item{"item " + ToString(i), i % 100, i % 3 == 0};
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: Create rows");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+	bench.epochs(3).epochIterations(1);
+
+	bench.run("Create and destroy " + ToString(num_rows) + " rows", [&] {
+		items = new_items;
+		model_handle.DirtyVariable("items");
+		context->Update();
+
+		items.clear();
+		model_handle.DirtyVariable("items");
+		context->Update();
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("data_binding.auto_dirty")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Item {
+		String name;
+		int value;
+	};
+	// Each item is bound to two addresses by its views, 'items[i].name' and 'items[i].value'.
+	Vector<Item> items(5000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = Item{"item " + ToString(i), i % 100};
+
+	DataModelConstructor constructor = context->CreateDataModel("list");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<Item>())
+	{
+		handle.RegisterMember("name", &Item::name);
+		handle.RegisterMember("value", &Item::value);
+	}
+	constructor.RegisterArray<Vector<Item>>();
+	constructor.Bind("items", &items);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(list_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	nanobench::Rng rng;
+	nanobench::Bench bench;
+	bench.title("Data bindings: Auto dirty with 10k bindings");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.minEpochIterations(10);
+	bench.relative(true);
+
+	bench.run("Update without changes", [&] { context->Update(); });
+
+	bench.run("Dirty all variables, change one entry", [&] {
+		const int index = (int)rng.bounded((uint32_t)items.size());
+		items[index].name = "item " + ToString(rng.bounded(1000));
+		model_handle.DirtyAllVariables();
+		context->Update();
+	});
+
+	model_handle.EnableAutoDirty(true);
+	context->Update();
+
+	bench.run("Auto dirty, update without changes", [&] { context->Update(); });
+
+	bench.run("Auto dirty, change one entry", [&] {
+		const int index = (int)rng.bounded((uint32_t)items.size());
+		items[index].name = "item " + ToString(rng.bounded(1000));
+		context->Update();
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
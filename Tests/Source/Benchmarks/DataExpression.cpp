@@ -52,6 +52,7 @@ TEST_CASE("data_expressions")
 	nanobench::Bench bench;
 	bench.title("Data expression");
 	bench.relative(true);
+	bench.minEpochIterations(1000);
 
 	auto bench_expression = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface);
@@ -61,11 +62,11 @@ TEST_CASE("data_expressions")
 
 		REQUIRE(result);
 
-		Program program = parser.ReleaseProgram();
-		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		DataExpression data_expression(expression);
+		REQUIRE(data_expression.Parse(interface, false));
 
-		bench.run(execute_name, [&] { result &= interpreter.Run(); });
+		Variant value;
+		bench.run(execute_name, [&] { result &= data_expression.Run(interface, value); });
 
 		REQUIRE(result);
 	};
@@ -74,6 +75,10 @@ TEST_CASE("data_expressions")
 
 	bench_expression("true || false ? true && radius==1+2 ? 'Absolutely!' : color_value : 'no'", "Complex (parse)", "Complex (execute)");
 
+	bench_expression("radius * 2 > 10 && color_name != 'red' ? 'large' : 'small'", "Variables (parse)", "Variables (execute)");
+
+	bench_expression("radius * 3.5 | format(2)", "Transform (parse)", "Transform (execute)");
+
 	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface);
 
@@ -82,11 +87,11 @@ TEST_CASE("data_expressions")
 
 		REQUIRE(result);
 
-		Program program = parser.ReleaseProgram();
-		AddressList addresses = parser.ReleaseAddresses();
-		DataInterpreter interpreter(program, addresses, interface);
+		DataExpression data_expression(expression);
+		REQUIRE(data_expression.Parse(interface, true));
 
-		bench.run(execute_name, [&] { result &= interpreter.Run(); });
+		Variant value;
+		bench.run(execute_name, [&] { result &= data_expression.Run(interface, value); });
 
 		REQUIRE(result);
 	};
@@ -315,3 +315,68 @@ TEST_CASE("element.asymptotic_complexity")
 
 	document->Close();
 }
+
+static const char* StaticRow = R"(
+			<div class="row">
+				<div class="col col1"><a>Route %d</a></div>
+				<div class="col col23"><p>Distance <span>%d</span> of <span>%d</span></p></div>
+				<div class="col col4">Assigned</div>
+				<div class="inrow unmark_collapse">
+					<div class="col col123 assign_text">Assign to route</div>
+					<div class="col col4"><span>Value %d</span></div>
+				</div>
+			</div>)";
+
+TEST_CASE("element.idle")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	constexpr int num_rows = 1000;
+	const String rml = GenerateRml(num_rows, StaticRow);
+
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	String msg = Rml::CreateString("\nIdle updates of a mostly static document with %d total elements.\n", GetNumDescendentElements(el));
+	msg += TestsShell::GetRenderStats();
+	MESSAGE(msg);
+
+	nanobench::Bench bench;
+	bench.title("Element idle");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Update (unmodified)", [&] { context->Update(); });
+
+	bench.run("Render (unmodified)", [&] { context->Render(); });
+
+	bool hover_toggle = true;
+	Element* child = el->GetChild(num_rows / 2);
+
+	bench.run("Update (hover child)", [&] {
+		child->SetPseudoClass(":hover", hover_toggle);
+		hover_toggle = !hover_toggle;
+		context->Update();
+	});
+
+	Element* leaf = child->GetFirstChild()->GetFirstChild();
+	REQUIRE(leaf);
+	float opacity = 1.f;
+
+	bench.run("Update (leaf property)", [&] {
+		opacity = (opacity == 1.f ? 0.5f : 1.f);
+		leaf->SetProperty(PropertyId::Opacity, Property(opacity, Unit::NUMBER));
+		context->Update();
+	});
+
+	document->Close();
+}
@@ -0,0 +1,245 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Mesh.h>
+#include <RmlUi/Core/TextShapingContext.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String rml_long_text_document = R"(
+<rml>
+<head>
+    <title>Long text</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body {
+			font-size: 16px;
+			word-break: %s;
+		}
+	</style>
+</head>
+<body>
+%s
+</body>
+</rml>
+)";
+
+static String GenerateParagraphs(int num_paragraphs, int num_words, int max_word_length)
+{
+	const char* words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do", "eiusmod", "tempor",
+		"incididunt", "ut", "labore", "et", "dolore", "magna", "aliqua", "enim", "ad", "minim", "veniam", "quis", "nostrud", "exercitation"};
+	const int num_available_words = int(sizeof(words) / sizeof(words[0]));
+
+	String result;
+	int word_index = 0;
+	for (int i = 0; i < num_paragraphs; i++)
+	{
+		result += "<p>";
+		for (int j = 0; j < num_words; j++)
+		{
+			// Join some words together to form longer words.
+			String word;
+			do
+			{
+				word += words[(word_index * 7 + j) % num_available_words];
+				word_index++;
+			} while ((int)word.size() < max_word_length && word_index % 3 == 0);
+
+			if (j > 0)
+				result += ' ';
+			result += word;
+		}
+		result += "</p>\n";
+	}
+	return result;
+}
+
+TEST_CASE("element_text.resize")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Long text resize");
+	bench.minEpochIterations(10);
+	bench.relative(true);
+
+	struct TextCase {
+		const char* name;
+		const char* word_break;
+		int max_word_length;
+	};
+	const TextCase text_cases[] = {
+		{"Normal words", "normal", 0},
+		{"Long words with break-all", "break-all", 60},
+	};
+
+	for (const TextCase& text_case : text_cases)
+	{
+		const String rml_document = CreateString(rml_long_text_document.c_str(), text_case.word_break,
+			GenerateParagraphs(20, 200, text_case.max_word_length).c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+		document->Show();
+		context->Update();
+		context->Render();
+
+		int width = 400;
+		bench.run(text_case.name, [&]() {
+			width = (width == 400 ? 401 : 400);
+			document->SetProperty("width", CreateString("%dpx", width));
+			context->Update();
+		});
+
+		document->Close();
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("element_text.generate_string")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String rml_document = CreateString(rml_long_text_document.c_str(), "normal", GenerateParagraphs(1, 20, 0).c_str());
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const FontFaceHandle font_face_handle = document->GetFontFaceHandle();
+	REQUIRE(font_face_handle);
+
+	const String string = GenerateParagraphs(1, 20, 0).substr(3, 100);
+	const String language;
+	const TextShapingContext text_shaping_context{language, Style::Direction::Ltr, 0.f};
+
+	nanobench::Bench bench;
+	bench.title("Text string");
+	bench.minEpochIterations(1000);
+	bench.relative(true);
+
+	bench.run("Generate string", [&]() {
+		TexturedMeshList mesh_list;
+		const int width = font_engine_interface->GenerateString(context->GetRenderManager(), font_face_handle, 0, string, Vector2f(0, 0),
+			ColourbPremultiplied(255), 1.f, text_shaping_context, mesh_list);
+		nanobench::doNotOptimizeAway(width);
+	});
+
+	bench.run("Measure string", [&]() {
+		const int width = font_engine_interface->GetStringWidth(font_face_handle, string, text_shaping_context);
+		nanobench::doNotOptimizeAway(width);
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("element_text.font_sizes")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const String string = "The quick brown fox jumps over the lazy dog";
+	const String language;
+	const TextShapingContext text_shaping_context{language, Style::Direction::Ltr, 0.f};
+
+	nanobench::Bench bench;
+	bench.title("Font sizes");
+	bench.relative(true);
+
+	// Creates a font face handle for every size, as when text is scaled or animated. The handles are released on every iteration.
+	bench.run("Create handles and measure string", [&]() {
+		ReleaseFontResources();
+		for (int font_size = 8; font_size < 72; font_size++)
+		{
+			const FontFaceHandle handle =
+				font_engine_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, font_size);
+			const int width = font_engine_interface->GetStringWidth(handle, string, text_shaping_context);
+			nanobench::doNotOptimizeAway(width);
+		}
+	});
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("element_text.repeated")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// A list with the same labels repeated on every row, such as a data-bound list.
+	String rows;
+	for (int i = 0; i < 500; i++)
+		rows += CreateString("<div class=\"row\"><span>Item</span> <span>%d</span> <span>units</span> <span>Buy</span> <span>Sell</span></div>\n", i % 10);
+
+	const String rml_document = CreateString(rml_long_text_document.c_str(), "normal", rows.c_str());
+
+	nanobench::Bench bench;
+	bench.title("Repeated text");
+	bench.minEpochIterations(10);
+	bench.relative(true);
+
+	bench.run("Load and render", [&]() {
+		ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+		document->Show();
+		context->Update();
+		context->Render();
+		document->Close();
+		context->Update();
+	});
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	int width = 400;
+	bench.run("Resize and render", [&]() {
+		width = (width == 400 ? 401 : 400);
+		document->SetProperty("width", CreateString("%dpx", width));
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -668,3 +668,70 @@ TEST_CASE("flexbox.shrink-to-fit")
 
 	document->Close();
 }
+
+static const String rml_flexbox_nested_document = R"(
+<rml>
+<head>
+    <title>Flex - Deeply nested</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 1000px; }
+		.row, .column {
+			display: flex;
+			border: 1px #e8e8e8;
+			padding: 2px;
+		}
+		.row { flex-direction: row; }
+		.column { flex-direction: column; }
+	</style>
+</head>
+<body>
+<div id="outer"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("flexbox.nested")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Flexbox nested");
+	bench.relative(true);
+
+	// Nest flex containers with alternating directions and content-based sizing, where each level formats its items several times.
+	auto MakeNestedRml = [](int depth) {
+		String rml = "Content";
+		for (int i = 0; i < depth; i++)
+		{
+			const char* direction = (i % 2 == 0 ? "row" : "column");
+			rml = CreateString("<div class=\"%s\"><div>Item %d</div>%s</div>", direction, i, rml.c_str());
+		}
+		return rml;
+	};
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_nested_document);
+	Element* outer = document->GetElementById("outer");
+	document->Show();
+
+	for (int depth : {2, 4, 6, 8})
+	{
+		const String rml = MakeNestedRml(depth);
+		outer->SetInnerRML(rml);
+		TestsShell::RenderLoop();
+
+		bench.run("SetInnerRML + Update (depth " + ToString(depth) + ")", [&] {
+			outer->SetInnerRML(rml);
+			context->Update();
+		});
+		bench.run("Resize + Update (depth " + ToString(depth) + ")", [&] {
+			document->SetProperty(PropertyId::Width, Property(float(900 + depth), Unit::PX));
+			context->Update();
+			document->RemoveProperty(PropertyId::Width);
+			context->Update();
+		});
+	}
+
+	document->Close();
+}
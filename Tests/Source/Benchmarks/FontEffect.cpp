@@ -27,9 +27,12 @@
  */
 
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ConvolutionFilter.h>
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -85,3 +88,127 @@ TEST_CASE("font_effect")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("font_effect.large")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Large fonts at a high density-independent pixel ratio, where generating the font effect layers can stall the first frame.
+	context->SetDensityIndependentPixelRatio(2.f);
+
+	nanobench::Bench bench;
+	bench.title("Font effect (large)");
+	bench.relative(true);
+
+	for (const char* effect_name : {"shadow", "blur", "outline", "glow"})
+	{
+		constexpr int effect_size = 16;
+
+		String rml_document = CreateString(rml_font_effect_document.c_str(), effect_name, effect_size);
+		rml_document = StringUtilities::Replace(rml_document, "font-size: 25px;", "font-size: 60dp;");
+
+		ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+		document->Show();
+		context->Update();
+		context->Render();
+
+		bench.run(effect_name, [&]() {
+			Rml::ReleaseFontResources();
+			context->Render();
+		});
+
+		document->Close();
+	}
+
+	context->SetDensityIndependentPixelRatio(1.f);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_effect.worker_threads")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	context->SetDensityIndependentPixelRatio(2.f);
+
+	nanobench::Bench bench;
+	bench.title("Font effect (worker threads)");
+	bench.relative(true);
+
+	String rml_document = CreateString(rml_font_effect_document.c_str(), "glow", 16);
+	rml_document = StringUtilities::Replace(rml_document, "font-size: 25px;", "font-size: 60dp;");
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	for (int num_threads : {0, 1, 2, 4})
+	{
+		Rml::SetFontWorkerThreads(num_threads);
+
+		bench.run(CreateString("%d worker threads", num_threads), [&]() {
+			Rml::ReleaseFontResources();
+			context->Render();
+		});
+	}
+
+	Rml::SetFontWorkerThreads(0);
+	document->Close();
+	context->SetDensityIndependentPixelRatio(1.f);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_effect.convolution_filter")
+{
+	nanobench::Bench bench;
+	bench.title("Convolution filter");
+	bench.relative(true);
+
+	const Vector2i source_dimensions = {256, 256};
+	Vector<byte> source(source_dimensions.x * source_dimensions.y);
+	for (int i = 0; i < (int)source.size(); i++)
+		source[i] = byte((i * 7919) % 256);
+
+	struct FilterCase {
+		const char* name;
+		Vector2i kernel_radii;
+		FilterOperation operation;
+	};
+	const FilterCase filter_cases[] = {
+		{"Blur, horizontal pass (radius 16)", Vector2i(16, 0), FilterOperation::Sum},
+		{"Blur, vertical pass (radius 16)", Vector2i(0, 16), FilterOperation::Sum},
+		{"Outline (radius 8)", Vector2i(8, 8), FilterOperation::Dilation},
+	};
+
+	for (const FilterCase& filter_case : filter_cases)
+	{
+		ConvolutionFilter filter;
+		filter.Initialise(filter_case.kernel_radii, filter_case.operation);
+
+		const Vector2i kernel_size = filter_case.kernel_radii * 2 + Vector2i(1);
+		for (int y = 0; y < kernel_size.y; y++)
+		{
+			for (int x = 0; x < kernel_size.x; x++)
+			{
+				const Vector2i delta = Vector2i(x, y) - filter_case.kernel_radii;
+				const bool inside_circle = (delta.x * delta.x + delta.y * delta.y <= filter_case.kernel_radii.x * filter_case.kernel_radii.y);
+				if (filter_case.operation == FilterOperation::Sum)
+					filter[y][x] = 1.f / float(kernel_size.x * kernel_size.y);
+				else
+					filter[y][x] = (inside_circle ? 1.f : 0.f);
+			}
+		}
+
+		const Vector2i destination_dimensions = source_dimensions + filter_case.kernel_radii * 2;
+		const int destination_stride = destination_dimensions.x * 4;
+		Vector<byte> destination(destination_stride * destination_dimensions.y);
+
+		bench.run(filter_case.name, [&]() {
+			filter.Run(destination.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source.data(), source_dimensions,
+				filter_case.kernel_radii, ColorFormat::A8);
+			nanobench::doNotOptimizeAway(destination);
+		});
+	}
+}
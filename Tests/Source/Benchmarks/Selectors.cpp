@@ -30,6 +30,7 @@
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 #include <nanobench.h>
@@ -293,3 +294,200 @@ TEST_CASE("Selectors")
 		context->Update();
 	}
 }
+
+TEST_CASE("Selectors.descendant")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	const String rml = GenerateRml(num_rows);
+
+	// Benchmark style sheets with many rules using descendant and child combinators, where the rightmost selector matches a lot of elements while
+	// the ancestor selectors only rarely match. Each such rule requires walking the element's ancestors, unless it can be ruled out in advance.
+
+	nanobench::Bench bench;
+	bench.title("Selector (descendant rules)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const Vector<String> rule_formats = {
+		".%s .col",
+		".%s > div .col",
+		"#%s .row div",
+		".%s .inrow > .col4",
+	};
+
+	for (int i = 0; i <= (int)rule_formats.size(); i++)
+	{
+		const bool reference = (i == 0);
+
+		String name, styles;
+		if (reference)
+		{
+			name = "Reference (no style rules)";
+		}
+		else
+		{
+			const String& format = rule_formats[i - 1];
+			name = CreateString(format.c_str(), "a");
+			for (int j = 0; j < num_rule_iterations; j++)
+			{
+				for (char c = 'a'; c <= 'z'; c++)
+				{
+					const String rule_name = String(j + 1, c) + "x";
+					styles += CreateString(format.c_str(), rule_name.c_str());
+					styles += CreateString(" { scrollbar-margin: %dpx; }\n", int(c - 'a') + 1);
+				}
+			}
+		}
+
+		const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		context->Update();
+		context->Render();
+
+		bool hover_active = false;
+
+		bench.run(name.c_str(), [&] {
+			hover_active = !hover_active;
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
+
+TEST_CASE("Selectors.class_selectivity")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	const String rml = GenerateRml(num_rows);
+
+	// Benchmark style sheets with many rules combining a common class with a rare one. Unless the rules are indexed by their rarest class, every
+	// element with the common class needs to be matched against all the rules.
+
+	nanobench::Bench bench;
+	bench.title("Selector (class selectivity)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const Vector<String> rule_formats = {
+		".col.%s",
+		".col.col4.%s",
+		".row .col.%s",
+	};
+
+	for (int i = 0; i <= (int)rule_formats.size(); i++)
+	{
+		const bool reference = (i == 0);
+
+		String name, styles;
+		if (reference)
+		{
+			name = "Reference (no style rules)";
+		}
+		else
+		{
+			const String& format = rule_formats[i - 1];
+			name = CreateString(format.c_str(), "a");
+			for (int j = 0; j < num_rule_iterations; j++)
+			{
+				for (char c = 'a'; c <= 'z'; c++)
+				{
+					const String rule_name = String(j + 1, c) + "x";
+					styles += CreateString(format.c_str(), rule_name.c_str());
+					styles += CreateString(" { scrollbar-margin: %dpx; }\n", int(c - 'a') + 1);
+				}
+			}
+		}
+
+		const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		context->Update();
+		context->Render();
+
+#ifdef RMLUI_STYLESHEET_MATCHING_STATISTICS
+		const StyleSheet* style_sheet = document->GetStyleSheet();
+		const StyleSheet::MatchingStatistics before = style_sheet->GetMatchingStatistics();
+#endif
+
+		bool hover_active = false;
+
+		bench.run(name.c_str(), [&] {
+			hover_active = !hover_active;
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+
+#ifdef RMLUI_STYLESHEET_MATCHING_STATISTICS
+		const StyleSheet::MatchingStatistics& after = style_sheet->GetMatchingStatistics();
+		const double num_lookups = double(after.num_lookups - before.num_lookups);
+		MESSAGE(CreateString("%s: %.1f candidate nodes, %.1f tested nodes, and %.1f matched nodes per element.", name.c_str(),
+			double(after.num_candidate_nodes - before.num_candidate_nodes) / num_lookups,
+			double(after.num_tested_nodes - before.num_tested_nodes) / num_lookups,
+			double(after.num_matched_nodes - before.num_matched_nodes) / num_lookups));
+#endif
+
+		document->Close();
+		context->Update();
+	}
+}
+
+TEST_CASE("Selectors.hover")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	const String rml = GenerateRml(num_rows);
+
+	// Benchmark moving the hover state between rows, like the context does when updating the hover chain. Only the elements affected by the
+	// hover pseudo class according to the style sheet's selectors should need to be restyled, rather than all siblings and their descendants.
+
+	nanobench::Bench bench;
+	bench.title("Selector (hover)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	const String styles = ".row:hover { background-color: #333; }\n.row:hover .col4 { color: #fff; }";
+	const String compiled_document_rml = Rml::CreateString(document_rml_template, styles.c_str());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+
+	ElementList rows;
+	el->GetElementsByClassName(rows, "row");
+	REQUIRE(rows.size() == num_rows);
+
+	size_t hover_index = 0;
+
+	bench.run("Move hover between rows", [&] {
+		rows[hover_index]->SetPseudoClass("hover", false);
+		hover_index = (hover_index + 1) % rows.size();
+		rows[hover_index]->SetPseudoClass("hover", true);
+		context->Update();
+	});
+
+	document->Close();
+	context->Update();
+}
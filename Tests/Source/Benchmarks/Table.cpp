@@ -315,3 +315,62 @@ TEST_CASE("table_inline-block")
 
 	document->Close();
 }
+
+static const String rml_table_nested_document = R"(
+<rml>
+<head>
+    <title>Table nested</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 1000px; }
+		table { border: 1px #666; }
+		td { padding: 2px; vertical-align: middle; }
+	</style>
+</head>
+<body>
+<div id="outer"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("table_nested")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Table nested");
+	bench.relative(true);
+
+	// Nest tables with auto-sized rows and vertically aligned cells, where each level formats its cells several times.
+	auto MakeNestedRml = [](int depth) {
+		String rml = "Content";
+		for (int i = 0; i < depth; i++)
+			rml = CreateString("<table><tr><td>Cell %d</td><td>%s</td></tr></table>", i, rml.c_str());
+		return rml;
+	};
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_table_nested_document);
+	Element* outer = document->GetElementById("outer");
+	document->Show();
+
+	for (int depth : {2, 4, 6, 8})
+	{
+		const String rml = MakeNestedRml(depth);
+		outer->SetInnerRML(rml);
+		TestsShell::RenderLoop();
+
+		bench.run("SetInnerRML + Update (depth " + ToString(depth) + ")", [&] {
+			outer->SetInnerRML(rml);
+			context->Update();
+		});
+		bench.run("Resize + Update (depth " + ToString(depth) + ")", [&] {
+			document->SetProperty(PropertyId::Width, Property(float(900 + depth), Unit::PX));
+			context->Update();
+			document->RemoveProperty(PropertyId::Width);
+			context->Update();
+		});
+	}
+
+	document->Close();
+}
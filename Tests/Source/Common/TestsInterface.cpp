@@ -121,17 +121,24 @@ Rml::CompiledGeometryHandle TestsRenderInterface::CompileGeometry(Rml::Span<cons
 		}
 	}
 
-	return Rml::CompiledGeometryHandle(counters.compile_geometry);
+	last_geometry_handle += 1;
+	num_compiled_indices[last_geometry_handle] = indices.size();
+
+	return last_geometry_handle;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::CompiledGeometryHandle /*geometry*/, Rml::Vector2f /*translation*/, Rml::TextureHandle /*texture*/)
+void TestsRenderInterface::RenderGeometry(Rml::CompiledGeometryHandle geometry, Rml::Vector2f /*translation*/, Rml::TextureHandle /*texture*/)
 {
 	counters.render_geometry += 1;
+	auto it = num_compiled_indices.find(geometry);
+	REQUIRE_MESSAGE(it != num_compiled_indices.end(), "RenderGeometry: Geometry handle was not compiled or has been released");
+	counters.render_indices += it->second;
 }
 
-void TestsRenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle /*geometry*/)
+void TestsRenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle geometry)
 {
 	counters.release_geometry += 1;
+	num_compiled_indices.erase(geometry);
 }
 
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
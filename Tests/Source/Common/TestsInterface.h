@@ -62,6 +62,7 @@ public:
 	struct Counters {
 		size_t compile_geometry;
 		size_t render_geometry;
+		size_t render_indices;
 		size_t release_geometry;
 		size_t load_texture;
 		size_t generate_texture;
@@ -117,6 +118,8 @@ private:
 	Counters counters_from_previous_reset = {};
 	Rml::Vector<Rml::Mesh> meshes;
 	bool meshes_set = false;
+	Rml::UnorderedMap<Rml::CompiledGeometryHandle, size_t> num_compiled_indices;
+	Rml::CompiledGeometryHandle last_geometry_handle = 0;
 };
 
 #endif
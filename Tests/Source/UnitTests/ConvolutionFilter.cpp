@@ -0,0 +1,139 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+// Straightforward scalar implementation of the convolution filter, the optimized filter must produce identical results.
+static void RunReferenceFilter(const Vector<float>& kernel, Vector2i kernel_size, FilterOperation operation, byte* destination,
+	Vector2i destination_dimensions, int destination_stride, ColorFormat destination_color_format, const byte* source, Vector2i source_dimensions,
+	Vector2i source_offset, ColorFormat source_color_format)
+{
+	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
+	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int source_alpha_offset = (source_color_format == ColorFormat::RGBA8 ? 3 : 0);
+
+	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = 0.f;
+
+			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			{
+				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
+					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+					{
+						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
+						const float pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
+
+						switch (operation)
+						{
+						case FilterOperation::Sum: opacity += pixel_opacity; break;
+						case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
+						}
+					}
+				}
+			}
+
+			opacity = Math::Min(255.f, opacity);
+
+			const int destination_index = y * destination_stride + x * destination_bytes_per_pixel + destination_alpha_offset;
+			destination[destination_index] = byte(opacity);
+		}
+	}
+}
+
+TEST_CASE("ConvolutionFilter")
+{
+	uint32_t random_state = 12345;
+	auto Random = [&random_state](int max_value) {
+		random_state = random_state * 1664525u + 1013904223u;
+		return int((random_state >> 8) % uint32_t(max_value + 1));
+	};
+
+	for (int i = 0; i < 200; i++)
+	{
+		const FilterOperation operation = (i % 2 == 0 ? FilterOperation::Sum : FilterOperation::Dilation);
+		const Vector2i kernel_radii = (i % 3 == 0 ? Vector2i(Random(6), 0) : Vector2i(Random(6), Random(6)));
+		const Vector2i kernel_size = kernel_radii * 2 + Vector2i(1);
+		const ColorFormat source_format = (Random(1) ? ColorFormat::RGBA8 : ColorFormat::A8);
+		const ColorFormat destination_format = (Random(1) ? ColorFormat::RGBA8 : ColorFormat::A8);
+		const Vector2i source_dimensions = {Random(40), Random(40)};
+		const Vector2i source_offset = (Random(1) ? kernel_radii : Vector2i(Random(3), Random(3)));
+		const Vector2i destination_dimensions = source_dimensions + source_offset * 2;
+		const int destination_bytes_per_pixel = (destination_format == ColorFormat::RGBA8 ? 4 : 1);
+		const int destination_stride = destination_dimensions.x * destination_bytes_per_pixel + Random(5);
+
+		INFO("Iteration ", i, ", kernel radii (", kernel_radii.x, ", ", kernel_radii.y, "), source dimensions (", source_dimensions.x, ", ",
+			source_dimensions.y, ")");
+
+		ConvolutionFilter filter;
+		REQUIRE(filter.Initialise(kernel_radii, operation));
+
+		// Use fractional weights of varying magnitude to expose any differences in rounding, and add some zero weights. Sums are scaled to mostly
+		// stay within the opacity range, so that they are not simply clamped.
+		const int num_weights = kernel_size.x * kernel_size.y;
+		const float weight_scale = (operation == FilterOperation::Sum ? 1.f / float(num_weights) : 1.f);
+		Vector<float> kernel(num_weights);
+		for (int y = 0; y < kernel_size.y; y++)
+		{
+			for (int x = 0; x < kernel_size.x; x++)
+			{
+				const float weight = (Random(5) == 0 ? 0.f : weight_scale * float(Random(1000)) / float(Random(1000) + 500));
+				kernel[y * kernel_size.x + x] = weight;
+				filter[y][x] = weight;
+			}
+		}
+
+		Vector<byte> source(source_dimensions.x * source_dimensions.y * (source_format == ColorFormat::RGBA8 ? 4 : 1));
+		for (byte& value : source)
+			value = byte(Random(3) == 0 ? 0 : Random(255));
+
+		Vector<byte> destination(destination_stride * destination_dimensions.y, byte(17));
+		Vector<byte> expected_destination = destination;
+
+		filter.Run(destination.data(), destination_dimensions, destination_stride, destination_format, source.data(), source_dimensions,
+			source_offset, source_format);
+		RunReferenceFilter(kernel, kernel_size, operation, expected_destination.data(), destination_dimensions, destination_stride,
+			destination_format, source.data(), source_dimensions, source_offset, source_format);
+
+		CHECK(destination == expected_destination);
+	}
+}
@@ -31,6 +31,7 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <algorithm>
 #include <cmath>
 #include <doctest.h>
 
@@ -610,3 +611,370 @@ TEST_CASE("data_binding.set_enum")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String dirty_address_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window {
+			width: 500px;
+			height: 400px;
+		}
+	</style>
+</head>
+<body template="window">
+<div data-model="dirty_address">
+<p id="count">{{ rows.size }}</p>
+<div data-for="row : rows"><span class="name">{{ row.name }}</span><span class="value">{{ row.value }}</span></div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.dirty_address")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Row {
+		String name;
+		int value;
+	};
+	Vector<Row> rows = {{"a", 0}, {"b", 1}, {"c", 2}};
+
+	DataModelConstructor constructor = context->CreateDataModel("dirty_address");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<Row>())
+	{
+		handle.RegisterMember("name", &Row::name);
+		handle.RegisterMember("value", &Row::value);
+	}
+	constructor.RegisterArray<Vector<Row>>();
+	constructor.Bind("rows", &rows);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(dirty_address_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	ElementList names, values;
+	document->QuerySelectorAll(names, ".name");
+	document->QuerySelectorAll(values, ".value");
+	REQUIRE(names.size() == 3);
+	REQUIRE(values.size() == 3);
+
+	// Only the views depending on the dirtied address are updated.
+	rows[1].name = "B";
+	rows[1].value = 10;
+	rows[2].name = "C";
+	model_handle.DirtyVariable(DataAddress{"rows", 1, "name"});
+	CHECK(model_handle.IsVariableDirty("rows"));
+	TestsShell::RenderLoop();
+
+	CHECK(!model_handle.IsVariableDirty("rows"));
+	CHECK(names[0]->GetInnerRML() == "a");
+	CHECK(names[1]->GetInnerRML() == "B");
+	CHECK(values[1]->GetInnerRML() == "1");
+	CHECK(names[2]->GetInnerRML() == "c");
+
+	// Dirtying an entry updates all the views depending on any part of it.
+	model_handle.DirtyVariable(DataAddress{"rows", 1});
+	TestsShell::RenderLoop();
+
+	CHECK(values[1]->GetInnerRML() == "10");
+	CHECK(names[2]->GetInnerRML() == "c");
+
+	// Dirtying the whole variable updates everything, including structural views.
+	rows.push_back({"d", 3});
+	model_handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	CHECK(names[2]->GetInnerRML() == "C");
+	CHECK(document->GetElementById("count")->GetInnerRML() == "4");
+	names.clear();
+	document->QuerySelectorAll(names, ".name");
+	CHECK(names.size() == 4);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String keyed_for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window {
+			width: 500px;
+			height: 400px;
+		}
+	</style>
+</head>
+<body template="window">
+<div data-model="keyed_for">
+<div class="row" data-for="row, i : rows" data-for-key="row.id"><span class="name">{{ row.name }}</span><span class="index">{{ i }}</span><span class="tag" data-for="tag : row.tags">{{ tag }}</span></div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.keyed_for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Row {
+		int id;
+		String name;
+		Vector<String> tags;
+	};
+	Vector<Row> rows = {{1, "a", {"a0"}}, {2, "b", {"b0", "b1"}}, {3, "c", {}}};
+
+	DataModelConstructor constructor = context->CreateDataModel("keyed_for");
+	REQUIRE(constructor);
+	constructor.RegisterArray<Vector<String>>();
+	if (auto handle = constructor.RegisterStruct<Row>())
+	{
+		handle.RegisterMember("id", &Row::id);
+		handle.RegisterMember("name", &Row::name);
+		handle.RegisterMember("tags", &Row::tags);
+	}
+	constructor.RegisterArray<Vector<Row>>();
+	constructor.Bind("rows", &rows);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(keyed_for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	ElementList elements;
+	auto GetRows = [&]() {
+		elements.clear();
+		document->QuerySelectorAll(elements, ".row");
+		// The last element is the placeholder of the 'data-for' view.
+		elements.pop_back();
+		return elements;
+	};
+	auto RowText = [](Element* element) {
+		String result = element->GetChild(0)->GetInnerRML() + ":" + element->GetChild(1)->GetInnerRML();
+		// The last child is the placeholder of the inner 'data-for' view.
+		for (int i = 2; i < element->GetNumChildren() - 1; i++)
+			result += ":" + element->GetChild(i)->GetInnerRML();
+		return result;
+	};
+
+	const ElementList initial_rows = GetRows();
+	REQUIRE(initial_rows.size() == 3);
+	CHECK(RowText(initial_rows[1]) == "b:1:b0:b1");
+
+	// Inserting a row creates only the new element, the existing elements are moved along with their data bindings.
+	rows.insert(rows.begin(), Row{4, "d", {"d0"}});
+	model_handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	ElementList current_rows = GetRows();
+	REQUIRE(current_rows.size() == 4);
+	CHECK(current_rows[1] == initial_rows[0]);
+	CHECK(current_rows[2] == initial_rows[1]);
+	CHECK(current_rows[3] == initial_rows[2]);
+	CHECK(RowText(current_rows[0]) == "d:0:d0");
+	CHECK(RowText(current_rows[2]) == "b:2:b0:b1");
+
+	// Reordering only moves the elements.
+	std::reverse(rows.begin(), rows.end());
+	model_handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	const ElementList reversed_rows = GetRows();
+	REQUIRE(reversed_rows.size() == 4);
+	for (size_t i = 0; i < reversed_rows.size(); i++)
+		CHECK(reversed_rows[i] == current_rows[current_rows.size() - 1 - i]);
+	CHECK(RowText(reversed_rows[0]) == "c:0");
+	CHECK(RowText(reversed_rows[1]) == "b:1:b0:b1");
+	CHECK(RowText(reversed_rows[3]) == "d:3:d0");
+
+	// Dirtying a part of an entry updates the row currently at that index.
+	rows[1].name = "B";
+	rows[1].tags.push_back("b2");
+	model_handle.DirtyVariable(DataAddress{"rows", 1});
+	TestsShell::RenderLoop();
+
+	CHECK(RowText(reversed_rows[1]) == "B:1:b0:b1:b2");
+	CHECK(RowText(reversed_rows[2]) == "a:2:a0");
+
+	// Rows are also moved when only the entries are dirtied.
+	std::swap(rows[2], rows[3]);
+	model_handle.DirtyVariable(DataAddress{"rows", 2});
+	model_handle.DirtyVariable(DataAddress{"rows", 3});
+	TestsShell::RenderLoop();
+
+	current_rows = GetRows();
+	REQUIRE(current_rows.size() == 4);
+	CHECK(current_rows[2] == reversed_rows[3]);
+	CHECK(current_rows[3] == reversed_rows[2]);
+	CHECK(RowText(current_rows[2]) == "d:2:d0");
+	CHECK(RowText(current_rows[3]) == "a:3:a0");
+
+	std::swap(rows[2], rows[3]);
+	model_handle.DirtyVariable(DataAddress{"rows", 2});
+	model_handle.DirtyVariable(DataAddress{"rows", 3});
+	TestsShell::RenderLoop();
+	CHECK(RowText(reversed_rows[2]) == "a:2:a0");
+
+	// Removing a row destroys only its element, also when combined with a change of key.
+	rows.erase(rows.begin() + 1);
+	rows[0].id = 5;
+	model_handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	current_rows = GetRows();
+	REQUIRE(current_rows.size() == 3);
+	CHECK(current_rows[0] != reversed_rows[0]);
+	CHECK(current_rows[1] == reversed_rows[2]);
+	CHECK(current_rows[2] == reversed_rows[3]);
+	CHECK(RowText(current_rows[0]) == "c:0");
+	CHECK(RowText(current_rows[1]) == "a:1:a0");
+
+	// Duplicate keys result in separate rows.
+	rows.push_back(rows.back());
+	model_handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+
+	current_rows = GetRows();
+	REQUIRE(current_rows.size() == 4);
+	CHECK(current_rows[2] != current_rows[3]);
+	CHECK(RowText(current_rows[2]) == "d:2:d0");
+	CHECK(RowText(current_rows[3]) == "d:3:d0");
+
+	rows.clear();
+	model_handle.DirtyVariable("rows");
+	TestsShell::RenderLoop();
+	CHECK(GetRows().empty());
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String auto_dirty_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/template" href="/assets/window.rml"/>
+	<style>
+		body.window {
+			width: 500px;
+			height: 400px;
+		}
+	</style>
+</head>
+<body template="window">
+<div data-model="auto_dirty">
+<p id="heading">{{ title }}</p>
+<p id="count">{{ rows.size }}</p>
+<div class="row" data-for="row : rows" data-for-key="row.id"><span class="name">{{ row.name }}</span></div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("data_binding.auto_dirty")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Row {
+		int id;
+		String name;
+	};
+	String title = "Title";
+	Vector<Row> rows = {{1, "a"}, {2, "b"}, {3, "c"}};
+
+	DataModelConstructor constructor = context->CreateDataModel("auto_dirty");
+	REQUIRE(constructor);
+	if (auto handle = constructor.RegisterStruct<Row>())
+	{
+		handle.RegisterMember("id", &Row::id);
+		handle.RegisterMember("name", &Row::name);
+	}
+	constructor.RegisterArray<Vector<Row>>();
+	constructor.Bind("title", &title);
+	constructor.Bind("rows", &rows);
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(auto_dirty_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	auto GetRows = [&]() {
+		ElementList elements;
+		document->QuerySelectorAll(elements, ".row");
+		// The last element is the placeholder of the 'data-for' view.
+		elements.pop_back();
+		return elements;
+	};
+	Element* heading_element = document->GetElementById("heading");
+	Element* count_element = document->GetElementById("count");
+
+	// Changes are not detected until enabled.
+	title = "New title";
+	TestsShell::RenderLoop();
+	CHECK(heading_element->GetInnerRML() == "Title");
+
+	model_handle.EnableAutoDirty(true);
+	TestsShell::RenderLoop();
+	CHECK(heading_element->GetInnerRML() == "Title");
+
+	title = "Auto title";
+	rows[1].name = "B";
+	TestsShell::RenderLoop();
+	CHECK(heading_element->GetInnerRML() == "Auto title");
+	CHECK(!model_handle.IsVariableDirty("title"));
+
+	const ElementList initial_rows = GetRows();
+	REQUIRE(initial_rows.size() == 3);
+	CHECK(initial_rows[0]->GetChild(0)->GetInnerRML() == "a");
+	CHECK(initial_rows[1]->GetChild(0)->GetInnerRML() == "B");
+
+	// Changes to the size of arrays update their structural views, and new views are watched too.
+	rows.push_back({4, "d"});
+	TestsShell::RenderLoop();
+	CHECK(count_element->GetInnerRML() == "4");
+	REQUIRE(GetRows().size() == 4);
+
+	rows[3].name = "D";
+	TestsShell::RenderLoop();
+	CHECK(GetRows()[3]->GetChild(0)->GetInnerRML() == "D");
+
+	// Changed keys of keyed views move the rows.
+	std::swap(rows[0], rows[2]);
+	TestsShell::RenderLoop();
+	ElementList current_rows = GetRows();
+	REQUIRE(current_rows.size() == 4);
+	CHECK(current_rows[0] == initial_rows[2]);
+	CHECK(current_rows[2] == initial_rows[0]);
+	CHECK(current_rows[0]->GetChild(0)->GetInnerRML() == "c");
+
+	rows.erase(rows.begin());
+	TestsShell::RenderLoop();
+	CHECK(count_element->GetInnerRML() == "3");
+	current_rows = GetRows();
+	REQUIRE(current_rows.size() == 3);
+	CHECK(current_rows[0]->GetChild(0)->GetInnerRML() == "B");
+
+	model_handle.EnableAutoDirty(false);
+	title = "Title";
+	TestsShell::RenderLoop();
+	CHECK(heading_element->GetInnerRML() == "Auto title");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -48,7 +48,7 @@ static String TestExpression(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, parser.GetStackSize(), addresses, interface);
 
 		if (interpreter.Run())
 			result = interpreter.Result().Get<String>();
@@ -73,7 +73,7 @@ static bool TestAssignment(const String& expression)
 		Program program = parser.ReleaseProgram();
 		AddressList addresses = parser.ReleaseAddresses();
 
-		DataInterpreter interpreter(program, addresses, interface);
+		DataInterpreter interpreter(program, parser.GetStackSize(), addresses, interface);
 		if (interpreter.Run())
 			result = true;
 		else
@@ -193,3 +193,68 @@ TEST_CASE("Data expressions")
 	CHECK(TestExpression("concatenate('It takes', num_trolls*3 + ' goats', 'to outsmart', num_trolls | number_suffix('troll','trolls'))") ==
 		"It takes,9 goats,to outsmart,3 trolls");
 }
+
+TEST_CASE("Data expressions.constant_folding")
+{
+	float height = 2.5f;
+
+	DataModelConstructor constructor(&model);
+	constructor.Bind("height", &height);
+
+	auto ProgramSize = [](const String& expression) {
+		DataParser parser(expression, interface);
+		REQUIRE(parser.Parse(false));
+		return parser.ReleaseProgram().size();
+	};
+
+	// Constant sub-expressions are folded into a single literal.
+	CHECK(ProgramSize("1 + 2 * 3") == 1);
+	CHECK(TestExpression("1 + 2 * 3") == "7");
+	CHECK(ProgramSize("!(1 + 2 > 2) || 'a' == 'b'") == 1);
+	CHECK(TestExpression("!(1 + 2 > 2) || 'a' == 'b'") == "0");
+	CHECK(ProgramSize("'Hello' + ' ' + 'world'") == 1);
+	CHECK(TestExpression("'Hello' + ' ' + 'world'") == "Hello world");
+
+	// Ternary operators with a literal condition are reduced to the selected branch, even if the branches are not constant.
+	CHECK(ProgramSize("true || false ? height : height * 2") == 1);
+	CHECK(TestExpression("true || false ? height : height * 2") == "2.5");
+	CHECK(TestExpression("1 > 2 ? height : height * 2") == "5");
+	CHECK(TestExpression("1 > 2 ? 'a' : 2 < 3 ? 'b' : 'c'") == "b");
+	CHECK(ProgramSize("1 > 2 ? 'a' : 2 < 3 ? 'b' : 'c'") == 1);
+
+	// Only the constant parts of expressions involving variables can be folded.
+	CHECK(ProgramSize("height * (2 + 3)") == 5);
+	CHECK(TestExpression("height * (2 + 3)") == "12.5");
+	CHECK(TestExpression("height > 2 ? 2 * 2 : 3 * 3") == "4");
+	CHECK(TestExpression("(height | format(1)) + (1 + 1)") == "2.52");
+}
+
+TEST_CASE("Data expressions.shared")
+{
+	int num_goats = 4;
+
+	DataModelConstructor constructor(&model);
+	constructor.Bind("num_goats", &num_goats);
+
+	DataExpression missing("num_sheep * 2");
+	INFO("Expected warning: Could not find data variable with name 'num_sheep'.");
+	CHECK(!missing.Parse(interface, false));
+	CHECK(!bool(model.GetExpressionCache().Find("num_sheep * 2", false)));
+
+	DataExpression first("num_goats * 2");
+	REQUIRE(first.Parse(interface, false));
+	ParsedExpressionPtr parsed_expression = model.GetExpressionCache().Find("num_goats * 2", false);
+	REQUIRE(bool(parsed_expression));
+	CHECK(parsed_expression->variable_names == StringList{"num_goats"});
+	CHECK(!bool(model.GetExpressionCache().Find("num_goats * 2", true)));
+
+	DataExpression second("num_goats * 2");
+	REQUIRE(second.Parse(interface, false));
+	REQUIRE(second.GetVariableAddressList().size() == 1);
+	CHECK(second.GetVariableAddressList()[0].size() == 1);
+	CHECK(second.GetVariableAddressList()[0][0].name == "num_goats");
+
+	Variant result;
+	REQUIRE(second.Run(interface, result));
+	CHECK(result.Get<int>() == 8);
+}
@@ -30,10 +30,13 @@
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include "../Common/TypesToString.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementUtilities.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/RenderManager.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -466,3 +469,249 @@ TEST_CASE("Element.ScrollIntoView")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_update_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		.hover:hover span { color: #f00; }
+	</style>
+</head>
+<body>
+	<div><div class="hover"><div><span id="leaf">Leaf</span></div></div></div>
+	<div><div><div id="other"/></div></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.Update")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	system_interface->SetTime(0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_update_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* leaf = document->GetElementById("leaf");
+	Element* other = document->GetElementById("other");
+	Element* hover = leaf->GetParentNode()->GetParentNode();
+
+	// Let the document settle, so that clean subtrees are skipped during subsequent updates.
+	for (int i = 0; i < 3; i++)
+		context->Update();
+
+	SUBCASE("Property")
+	{
+		leaf->SetProperty(PropertyId::Opacity, Property(0.5f, Unit::NUMBER));
+		context->Update();
+		CHECK(leaf->GetComputedValues().opacity() == 0.5f);
+
+		other->SetProperty("width", "40px");
+		context->Update();
+		CHECK(other->GetBox().GetSize().x == 40.f);
+	}
+
+	SUBCASE("Definition")
+	{
+		hover->SetPseudoClass("hover", true);
+		context->Update();
+		CHECK(leaf->GetComputedValues().color() == Colourb(255, 0, 0));
+
+		hover->SetPseudoClass("hover", false);
+		context->Update();
+		CHECK(leaf->GetComputedValues().color() != Colourb(255, 0, 0));
+	}
+
+	SUBCASE("Animation")
+	{
+		REQUIRE(leaf->Animate("opacity", Property(0.f, Unit::NUMBER), 1.f));
+
+		// Animations keep their element updated every frame, even without any other changes.
+		for (int i = 1; i <= 5; i++)
+		{
+			system_interface->SetTime(0.1 * i);
+			context->Update();
+		}
+		CHECK(leaf->GetComputedValues().opacity() == doctest::Approx(0.5f));
+
+		for (int i = 6; i <= 12; i++)
+		{
+			system_interface->SetTime(0.1 * i);
+			context->Update();
+		}
+		CHECK(leaf->GetComputedValues().opacity() == 0.f);
+	}
+
+	document->Close();
+	system_interface->SetTime(0);
+	TestsShell::ShutdownShell();
+}
+
+static const String document_clipping_rml = R"(
+<rml>
+<head>
+	<style>
+		body, div {
+			display: block;
+		}
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		#container {
+			position: absolute;
+			left: 50px;
+			top: 100px;
+			width: 200px;
+			height: 100px;
+			overflow: hidden;
+		}
+		#content {
+			height: 300px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="container">
+	<div id="content"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.ClippingRegion")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_clipping_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* container = document->GetElementById("container");
+	Element* content = document->GetElementById("content");
+
+	auto GetScissorRegion = [&]() {
+		context->Update();
+		context->Render();
+		RenderManager& render_manager = context->GetRenderManager();
+		REQUIRE(ElementUtilities::SetClippingRegion(content));
+		const Rectanglei scissor_region = render_manager.GetState().scissor_region;
+		render_manager.ResetState();
+		return scissor_region;
+	};
+
+	// Clipping regions are retained between renders, make sure they are refreshed whenever any of their inputs change.
+	CHECK(GetScissorRegion() == Rectanglei::FromPositionSize({50, 100}, {200, 100}));
+	CHECK(GetScissorRegion() == Rectanglei::FromPositionSize({50, 100}, {200, 100}));
+
+	SUBCASE("Offset")
+	{
+		container->SetProperty("top", "120px");
+		CHECK(GetScissorRegion() == Rectanglei::FromPositionSize({50, 120}, {200, 100}));
+	}
+
+	SUBCASE("Size")
+	{
+		container->SetProperty("width", "150px");
+		CHECK(GetScissorRegion() == Rectanglei::FromPositionSize({50, 100}, {150, 100}));
+	}
+
+	SUBCASE("Overflow")
+	{
+		container->SetProperty("overflow", "visible");
+		CHECK(!GetScissorRegion().Valid());
+
+		container->SetProperty("overflow", "hidden");
+		CHECK(GetScissorRegion() == Rectanglei::FromPositionSize({50, 100}, {200, 100}));
+	}
+
+	SUBCASE("Scrollable overflow")
+	{
+		content->SetProperty("height", "50px");
+		CHECK(!GetScissorRegion().Valid());
+	}
+
+	SUBCASE("Clip")
+	{
+		content->SetProperty("clip", "none");
+		CHECK(!GetScissorRegion().Valid());
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_shared_text_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 400px;
+		}
+	</style>
+</head>
+
+<body>
+<div>Buy</div>
+<div>Buy</div>
+<div>Buy</div>
+<div>Buy</div>
+<div>Buy</div>
+<div id="sell">Sell</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.SharedTextGeometry")
+{
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	// This test only works with the dummy renderer.
+	if (!render_interface)
+		return;
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_shared_text_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = render_interface->GetCounters();
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return counters;
+	};
+
+	// Text elements with identical text and font configuration share their geometry.
+	CHECK(RenderFrame().compile_geometry == 2);
+	CHECK(RenderFrame().compile_geometry == 0);
+
+	Element* sell = document->GetElementById("sell");
+	sell->SetInnerRML("Buy");
+	CHECK(RenderFrame().compile_geometry == 0);
+
+	// Geometry is generated separately for different colours, and reused when laying out equal lines again.
+	sell->SetProperty("color", "#f00");
+	CHECK(RenderFrame().compile_geometry == 1);
+
+	document->SetProperty("width", "300px");
+	CHECK(RenderFrame().compile_geometry == 0);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -202,3 +202,78 @@ TEST_CASE("FlexFormatting.dp_ratio")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_flex_nested_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 500px;
+			height: 300px;
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		#wrapper {
+			float: left;
+		}
+		.row, .column {
+			display: flex;
+			padding: 5px;
+		}
+		.row { flex-direction: row; }
+		.column { flex-direction: column; }
+	</style>
+</head>
+
+<body>
+	<div id="wrapper">
+		<div class="row" id="outer">
+			<div class="column">
+				<div class="row">
+					<div class="column"><div id="inner">Hello</div></div>
+				</div>
+			</div>
+		</div>
+	</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("FlexFormatting.nested_invalidation")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_flex_nested_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+
+	TestsShell::RenderLoop();
+	const Vector2f initial_size = outer->GetBox().GetSize();
+	const float initial_inner_height = inner->GetBox().GetSize().y;
+
+	// Changes deep inside the nested flex containers must not be hidden by any cached layout results of their ancestors.
+	inner->SetInnerRML("Hello big wide world");
+	TestsShell::RenderLoop();
+	const Vector2f text_size = outer->GetBox().GetSize();
+	CHECK(text_size.x > initial_size.x);
+	CHECK(text_size.y == initial_size.y);
+
+	inner->SetProperty("height", "50px");
+	TestsShell::RenderLoop();
+	CHECK(outer->GetBox().GetSize().x == text_size.x);
+	CHECK(outer->GetBox().GetSize().y == initial_size.y - initial_inner_height + 50.f);
+
+	inner->RemoveProperty("height");
+	inner->SetInnerRML("Hello");
+	TestsShell::RenderLoop();
+	CHECK(outer->GetBox().GetSize() == initial_size);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
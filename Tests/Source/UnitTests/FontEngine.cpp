@@ -0,0 +1,571 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/FontEffect.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/FontGlyph.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/Mesh.h>
+#include <RmlUi/Core/RenderManager.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <RmlUi/Core/TextShapingContext.h>
+#include <algorithm>
+#include <chrono>
+#include <doctest.h>
+#include <mutex>
+#include <thread>
+
+using namespace Rml;
+
+namespace {
+class FontFaceTester {
+public:
+	FontFaceTester(int font_size, const String& family = "latolatin") :
+		render_manager(TestsShell::GetContext()->GetRenderManager()), font_interface(GetFontEngineInterface()),
+		text_shaping_context{language, Style::Direction::Auto, 0.f}
+	{
+		handle = font_interface->GetFontFaceHandle(family, Style::FontStyle::Normal, Style::FontWeight::Normal, font_size);
+		REQUIRE(handle);
+	}
+
+	TexturedMeshList GenerateString(StringView string, FontEffectsHandle font_effects_handle = 0)
+	{
+		TexturedMeshList mesh_list;
+		font_interface->GenerateString(render_manager, handle, font_effects_handle, string, Vector2f(0, 50), ColourbPremultiplied(255), 1.f,
+			text_shaping_context, mesh_list);
+		return mesh_list;
+	}
+
+	FontEffectsHandle PrepareFontEffects(const FontEffectList& font_effects) { return font_interface->PrepareFontEffects(handle, font_effects); }
+
+	int GetStringWidth(StringView string) { return font_interface->GetStringWidth(handle, string, text_shaping_context); }
+
+	int GetVersion() { return font_interface->GetVersion(handle); }
+
+	// Returns the only non-empty mesh in the list.
+	static const TexturedMesh& GetSingleMesh(const TexturedMeshList& mesh_list)
+	{
+		const TexturedMesh* result = nullptr;
+		for (const TexturedMesh& textured_mesh : mesh_list)
+		{
+			if (textured_mesh.mesh.indices.empty())
+				continue;
+			REQUIRE(!result);
+			result = &textured_mesh;
+		}
+		REQUIRE(result);
+		return *result;
+	}
+
+	static size_t CountGlyphs(const TexturedMeshList& mesh_list)
+	{
+		size_t result = 0;
+		for (const TexturedMesh& textured_mesh : mesh_list)
+			result += textured_mesh.mesh.vertices.size() / 4;
+		return result;
+	}
+
+	RenderManager& render_manager;
+
+private:
+	FontEngineInterface* font_interface;
+	const String language;
+	TextShapingContext text_shaping_context;
+	FontFaceHandle handle = {};
+};
+
+// Captures the bitmaps of the glyphs passed to the effect, positioned relative to the pen position.
+class GlyphCaptureEffect : public FontEffect {
+public:
+	struct Bitmap {
+		Vector2i top_left;
+		Vector2i dimensions;
+		Vector<byte> data;
+
+		int GetCoverage(Vector2i position) const
+		{
+			const Vector2i p = position - top_left;
+			if (p.x < 0 || p.y < 0 || p.x >= dimensions.x || p.y >= dimensions.y)
+				return 0;
+			return data[p.y * dimensions.x + p.x];
+		}
+	};
+
+	GlyphCaptureEffect(size_t fingerprint) { SetFingerprint(fingerprint); }
+
+	bool HasUniqueTexture() const override { return true; }
+
+	bool GetGlyphMetrics(Vector2i& /*origin*/, Vector2i& /*dimensions*/, const FontGlyph& /*glyph*/) const override { return true; }
+
+	void GenerateGlyphTexture(byte* /*destination_data*/, Vector2i /*destination_dimensions*/, int /*destination_stride*/,
+		const FontGlyph& glyph) const override
+	{
+		REQUIRE(glyph.color_format == ColorFormat::A8);
+		const byte* data = glyph.bitmap_data;
+		bitmaps.push_back(Bitmap{Vector2i(glyph.bearing.x, -glyph.bearing.y), glyph.bitmap_dimensions,
+			Vector<byte>(data, data + glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y)});
+	}
+
+	mutable Vector<Bitmap> bitmaps;
+};
+
+// Renders a glyph not among the default glyphs of the given font, and returns the bitmap passed to the font effects.
+GlyphCaptureEffect::Bitmap CaptureGlyph(const String& family, int font_size, const String& character)
+{
+	// Use a new fingerprint every time, so that the effect layer is not cloned from any previous effects.
+	static size_t fingerprint = 0;
+	FontFaceTester tester(font_size, family);
+
+	// Start a new frame, so that glyphs captured previously can be evicted from the font atlas to make room.
+	TestsShell::GetContext()->Render();
+	auto effect = MakeShared<GlyphCaptureEffect>(++fingerprint);
+	const FontEffectsHandle font_effects_handle = tester.PrepareFontEffects({effect});
+
+	effect->bitmaps.clear();
+	tester.GenerateString(character, font_effects_handle);
+	REQUIRE(effect->bitmaps.size() == 1);
+	return effect->bitmaps[0];
+}
+
+// Records the threads generating the glyph textures, taking some time for each glyph to give all the threads a chance to help out.
+class ThreadRecordingEffect : public FontEffect {
+public:
+	ThreadRecordingEffect(size_t fingerprint) { SetFingerprint(fingerprint); }
+
+	bool HasUniqueTexture() const override { return true; }
+
+	bool GetGlyphMetrics(Vector2i& /*origin*/, Vector2i& /*dimensions*/, const FontGlyph& /*glyph*/) const override { return true; }
+
+	void GenerateGlyphTexture(byte* /*destination_data*/, Vector2i /*destination_dimensions*/, int /*destination_stride*/,
+		const FontGlyph& /*glyph*/) const override
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		std::lock_guard<std::mutex> lock(mutex);
+		num_glyphs += 1;
+		if (std::find(thread_ids.begin(), thread_ids.end(), std::this_thread::get_id()) == thread_ids.end())
+			thread_ids.push_back(std::this_thread::get_id());
+	}
+
+	mutable std::mutex mutex;
+	mutable int num_glyphs = 0;
+	mutable Vector<std::thread::id> thread_ids;
+};
+
+// Forwards to another file interface, while simulating memory mapping by reading the whole file into memory.
+class MappingFileInterface : public FileInterface {
+public:
+	MappingFileInterface(FileInterface* file_interface) : file_interface(file_interface) {}
+
+	FileHandle Open(const String& path) override { return file_interface->Open(path); }
+	void Close(FileHandle file) override { file_interface->Close(file); }
+	size_t Read(void* buffer, size_t size, FileHandle file) override
+	{
+		num_read_bytes += size;
+		return file_interface->Read(buffer, size, file);
+	}
+	bool Seek(FileHandle file, long offset, int origin) override { return file_interface->Seek(file, offset, origin); }
+	size_t Tell(FileHandle file) override { return file_interface->Tell(file); }
+
+	Span<const byte> MapFile(FileHandle file) override
+	{
+		mapped_data.resize(file_interface->Length(file));
+		file_interface->Read(mapped_data.data(), mapped_data.size(), file);
+		num_mapped_files += 1;
+		return mapped_data;
+	}
+	void UnmapFile(Span<const byte> data) override
+	{
+		CHECK(data.data() == mapped_data.data());
+		num_unmapped_files += 1;
+	}
+
+	size_t num_read_bytes = 0;
+	int num_mapped_files = 0;
+	int num_unmapped_files = 0;
+
+private:
+	FileInterface* file_interface;
+	Vector<byte> mapped_data;
+};
+} // namespace
+
+TEST_CASE("font_engine.append_glyphs")
+{
+	FontFaceTester tester(16);
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+
+	const int version = tester.GetVersion();
+	const TexturedMesh ascii_mesh = FontFaceTester::GetSingleMesh(tester.GenerateString("Hello"));
+	REQUIRE(ascii_mesh.mesh.vertices.size() == 5 * 4);
+
+	const Texture texture = ascii_mesh.texture;
+	Geometry geometry = tester.render_manager.MakeGeometry(Mesh(ascii_mesh.mesh));
+
+	render_interface->ResetCounters();
+	geometry.Render({}, texture);
+	CHECK(render_interface->GetCounters().generate_texture == 1);
+
+	// Add glyphs not among the default glyphs, they should be rendered immediately without changing the handle version.
+	render_interface->ResetCounters();
+	const TexturedMeshList accented_meshes = tester.GenerateString("\xC3\xA0\xC3\xA9\xC3\xAE\xC3\xB5\xC3\xBC");
+	CHECK(FontFaceTester::CountGlyphs(accented_meshes) == 5);
+	CHECK(tester.GetVersion() == version);
+
+	// Existing glyphs keep their texture coordinates, so that previously generated geometry remains valid.
+	const TexturedMesh ascii_mesh_after = FontFaceTester::GetSingleMesh(tester.GenerateString("Hello"));
+	CHECK(ascii_mesh_after.texture == texture);
+	REQUIRE(ascii_mesh_after.mesh.vertices.size() == ascii_mesh.mesh.vertices.size());
+	for (size_t i = 0; i < ascii_mesh.mesh.vertices.size(); i++)
+	{
+		CHECK(ascii_mesh_after.mesh.vertices[i].position == ascii_mesh.mesh.vertices[i].position);
+		CHECK(ascii_mesh_after.mesh.vertices[i].tex_coord == ascii_mesh.mesh.vertices[i].tex_coord);
+	}
+
+	// Only the texture the new glyphs were placed on is regenerated, in place.
+	geometry.Render({}, texture);
+	CHECK(render_interface->GetCounters().generate_texture == 1);
+
+	// Render calls submitted earlier in the frame may still use the old texture, thus it is only released at the start of the next frame.
+	CHECK(render_interface->GetCounters().release_texture == 0);
+	tester.render_manager.PrepareRender(tester.render_manager.GetViewport());
+	CHECK(render_interface->GetCounters().release_texture == 1);
+
+	geometry.Release();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.shared_atlas")
+{
+	FontFaceTester small_tester(12);
+	FontFaceTester large_tester(20);
+
+	// Glyphs of different font sizes are placed in the same atlas page, and thus rendered using the same texture.
+	const TexturedMesh small_mesh = FontFaceTester::GetSingleMesh(small_tester.GenerateString("Hello"));
+	const TexturedMesh large_mesh = FontFaceTester::GetSingleMesh(large_tester.GenerateString("Hello"));
+	CHECK(small_mesh.texture == large_mesh.texture);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.atlas_eviction")
+{
+	Context* context = TestsShell::GetContext();
+	FontFaceTester tester(16);
+	const int version = tester.GetVersion();
+	CHECK(FontFaceTester::CountGlyphs(tester.GenerateString("Hello")) == 5);
+
+	String string;
+	for (char32_t code_point = 'A'; code_point <= 'z'; code_point++)
+		string += char(code_point);
+
+	// Fill the atlas with large glyphs, one size each frame, so that the least recently used page holding the glyphs of our first handle is
+	// evicted. Pages used during the current frame are never evicted.
+	for (int font_size = 100; font_size <= 400; font_size += 20)
+	{
+		context->Render();
+		FontFaceTester large_tester(font_size);
+		large_tester.GenerateString(string);
+	}
+
+	// The evicted glyphs should be placed again when they are used.
+	context->Render();
+	CHECK(tester.GetVersion() != version);
+	CHECK(FontFaceTester::CountGlyphs(tester.GenerateString("Hello")) == 5);
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_atlas_eviction_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		#large {
+			font-size: 100px;
+		}
+	</style>
+</head>
+
+<body>
+<p id="static">Hello world</p>
+<p id="large"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("font_engine.atlas_eviction_displayed_text")
+{
+	Context* context = TestsShell::GetContext();
+	ElementDocument* document = context->LoadDocumentFromMemory(document_atlas_eviction_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* static_element = document->GetElementById("static");
+	Element* large_element = document->GetElementById("large");
+
+	String string;
+	for (char32_t code_point = 'A'; code_point <= 'z'; code_point++)
+		string += char(code_point);
+	large_element->SetInnerRML(string);
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		context->Render();
+	};
+	RenderFrame();
+
+	FontEngineInterface* font_interface = GetFontEngineInterface();
+	const FontFaceHandle static_handle = static_element->GetFontFaceHandle();
+	const FontFaceHandle first_large_handle = large_element->GetFontFaceHandle();
+	REQUIRE(static_handle);
+	REQUIRE(first_large_handle);
+	const int static_version = font_interface->GetVersion(static_handle);
+	const int first_large_version = font_interface->GetVersion(first_large_handle);
+
+	// Display ever larger text, until the atlas must evict pages to make room for it.
+	for (int font_size = 120; font_size <= 400; font_size += 20)
+	{
+		large_element->SetProperty("font-size", CreateString("%dpx", font_size));
+		RenderFrame();
+	}
+	CHECK(font_interface->GetVersion(first_large_handle) != first_large_version);
+
+	// The text displayed during every frame is never evicted, thus its geometry stays valid.
+	CHECK(font_interface->GetVersion(static_handle) == static_version);
+
+	// When a single frame needs more glyphs than the atlas can hold, the remaining glyphs are dropped for now instead of evicting text in use.
+	large_element->SetInnerRML(CreateString("<span style='font-size: 380px'>%s</span><span style='font-size: 360px'>%s</span>", string.c_str(),
+		string.c_str()));
+	RenderFrame();
+	RenderFrame();
+	CHECK(font_interface->GetVersion(static_handle) == static_version);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.distance_field")
+{
+	// Load the same font file as a separate family with distance-field glyph resampling enabled.
+	TestsShell::GetContext();
+	FileInterface* file_interface = GetFileInterface();
+	const FileHandle file = file_interface->Open("assets/LatoLatin-Regular.ttf");
+	REQUIRE(file);
+	Vector<byte> font_data(file_interface->Length(file));
+	file_interface->Read(font_data.data(), font_data.size(), file);
+	file_interface->Close(file);
+
+	SetFontDistanceFieldResampling(true);
+	REQUIRE(LoadFontFace(font_data, "latolatin-sdf", Style::FontStyle::Normal, Style::FontWeight::Normal));
+	SetFontDistanceFieldResampling(false);
+
+	// Compare glyphs generated from the distance field to glyphs rasterized directly by FreeType, which are hinted and thus not identical.
+	const char* characters[] = {"\xC3\x98", "\xC3\x9F", "\xC3\xA6", "\xC2\xA7"};
+	for (int font_size : {12, 16, 24, 48, 96, 150})
+	{
+		for (const char* character : characters)
+		{
+			INFO("Font size: ", font_size, ", character: ", character);
+			const GlyphCaptureEffect::Bitmap expected = CaptureGlyph("latolatin", font_size, character);
+			const GlyphCaptureEffect::Bitmap actual = CaptureGlyph("latolatin-sdf", font_size, character);
+
+			const Vector2i top_left = Math::Min(expected.top_left, actual.top_left);
+			const Vector2i bottom_right = Math::Max(expected.top_left + expected.dimensions, actual.top_left + actual.dimensions);
+
+			// Compare the total coverage, and the coverage difference between the bitmaps, relative to the total coverage.
+			int expected_coverage = 0;
+			int actual_coverage = 0;
+			int coverage_difference = 0;
+			for (int y = top_left.y; y < bottom_right.y; y++)
+			{
+				for (int x = top_left.x; x < bottom_right.x; x++)
+				{
+					const int expected_value = expected.GetCoverage({x, y});
+					const int actual_value = actual.GetCoverage({x, y});
+					expected_coverage += expected_value;
+					actual_coverage += actual_value;
+					coverage_difference += Math::Absolute(expected_value - actual_value);
+				}
+			}
+
+			REQUIRE(expected_coverage > 0);
+			CHECK(float(Math::Absolute(actual_coverage - expected_coverage)) / float(expected_coverage) < 0.08f);
+			CHECK(float(coverage_difference) / float(expected_coverage) < 0.2f);
+
+			// Identical bitmaps would indicate that the glyph was not generated from its distance field.
+			CHECK(coverage_difference > 0);
+		}
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.kerning")
+{
+	TestsShell::GetContext();
+
+	struct KerningPair {
+		String lhs;
+		String rhs;
+		// The expected kerning at each font size, as reported by FreeType for the face set to that size.
+		int expected[5];
+	};
+	const int font_sizes[] = {12, 16, 24, 48, 96};
+	const KerningPair pairs[] = {
+		{"T", "o", {-1, -1, -3, -6, -12}},
+		{"V", "\xC3\x80", {0, -1, -1, -3, -5}},
+		{"\xC3\x9D", "\xC3\xA0", {0, -1, -2, -4, -7}},
+	};
+
+	// Kerning is read once in font units and shared by all font sizes, check that it is scaled and rounded to each size like FreeType does.
+	for (int i = 0; i < 5; i++)
+	{
+		FontFaceTester tester(font_sizes[i]);
+		for (const KerningPair& pair : pairs)
+		{
+			INFO("Font size: ", font_sizes[i], ", pair: ", pair.lhs, pair.rhs);
+			const int kerning = tester.GetStringWidth(pair.lhs + pair.rhs) - tester.GetStringWidth(pair.lhs) - tester.GetStringWidth(pair.rhs);
+			CHECK(kerning == pair.expected[i]);
+		}
+	}
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.fallback_string_width")
+{
+	TestsShell::GetContext();
+	FileInterface* file_interface = GetFileInterface();
+	const FileHandle file = file_interface->Open("assets/LatoLatin-Regular.ttf");
+	REQUIRE(file);
+	Vector<byte> font_data(file_interface->Length(file));
+	file_interface->Read(font_data.data(), font_data.size(), file);
+	file_interface->Close(file);
+
+	// The emoji font has no glyphs for these letters, so they are measured as missing.
+	FontFaceTester tester(16, "noto emoji");
+	const int missing_width = tester.GetStringWidth("Hello");
+
+	// Once a fallback face provides the glyphs, the string should no longer be measured from the cache.
+	REQUIRE(LoadFontFace(font_data, "latolatin-fallback", Style::FontStyle::Normal, Style::FontWeight::Normal, true));
+	const int fallback_width = tester.GetStringWidth("Hello");
+	CHECK(fallback_width != missing_width);
+
+	// Kerning is only applied from the primary face, so the width is the sum of the glyph advances in the fallback face.
+	FontFaceTester fallback_tester(16, "latolatin-fallback");
+	int sum_advances = 0;
+	for (char character : String("Hello"))
+		sum_advances += fallback_tester.GetStringWidth(String(1, character));
+	CHECK(fallback_width == sum_advances);
+
+	// The measured width should match the glyphs rendered from the fallback face.
+	const TexturedMeshList meshes = tester.GenerateString("Hello");
+	CHECK(FontFaceTester::CountGlyphs(meshes) == 5);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.worker_threads")
+{
+	FontFaceTester tester(16);
+
+	// Without worker threads, all glyph textures are generated on the calling thread.
+	auto single_threaded_effect = MakeShared<ThreadRecordingEffect>(1);
+	const FontEffectsHandle single_threaded_handle = tester.PrepareFontEffects({single_threaded_effect});
+	REQUIRE(single_threaded_effect->num_glyphs > 1);
+	CHECK(single_threaded_effect->thread_ids.size() == 1);
+	const bool generated_on_calling_thread = (single_threaded_effect->thread_ids[0] == std::this_thread::get_id());
+	CHECK(generated_on_calling_thread);
+
+	// With worker threads, the same glyphs are generated, but they are now spread out over several threads.
+	SetFontWorkerThreads(4);
+	auto multi_threaded_effect = MakeShared<ThreadRecordingEffect>(2);
+	const FontEffectsHandle multi_threaded_handle = tester.PrepareFontEffects({multi_threaded_effect});
+	CHECK(multi_threaded_effect->num_glyphs == single_threaded_effect->num_glyphs);
+	CHECK(multi_threaded_effect->thread_ids.size() > 1);
+
+	// Both effect layers render every glyph, in addition to the base layer.
+	const TexturedMeshList single_threaded_meshes = tester.GenerateString("Hello", single_threaded_handle);
+	const TexturedMeshList multi_threaded_meshes = tester.GenerateString("Hello", multi_threaded_handle);
+	CHECK(FontFaceTester::CountGlyphs(single_threaded_meshes) == 2 * 5);
+	CHECK(FontFaceTester::CountGlyphs(multi_threaded_meshes) == 2 * 5);
+
+	SetFontWorkerThreads(0);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.lazy_loading")
+{
+	TestsShell::GetContext();
+	FileInterface* file_interface = GetFileInterface();
+	MappingFileInterface mapping_file_interface(file_interface);
+
+	const FileHandle file = file_interface->Open("assets/LatoLatin-Regular.ttf");
+	REQUIRE(file);
+	Vector<byte> font_data(file_interface->Length(file));
+	file_interface->Read(font_data.data(), font_data.size(), file);
+	file_interface->Close(file);
+
+	SetFontLazyLoading(true);
+
+	// Font files are mapped instead of read when loading lazily.
+	SetFileInterface(&mapping_file_interface);
+	CHECK(LoadFontFace("assets/LatoLatin-Regular.ttf"));
+	SetFileInterface(file_interface);
+	CHECK(mapping_file_interface.num_mapped_files == 1);
+	CHECK(mapping_file_interface.num_read_bytes == 0);
+
+	REQUIRE(LoadFontFace(font_data, "latolatin-lazy", Style::FontStyle::Normal, Style::FontWeight::Normal));
+	SetFontLazyLoading(false);
+
+	// The lazily loaded face is loaded on first use, and produces the same text as the face loaded right away.
+	FontFaceTester tester(16);
+	FontFaceTester lazy_tester(16, "latolatin-lazy");
+	const TexturedMesh mesh = FontFaceTester::GetSingleMesh(tester.GenerateString("Hello"));
+	const TexturedMesh lazy_mesh = FontFaceTester::GetSingleMesh(lazy_tester.GenerateString("Hello"));
+	REQUIRE(lazy_mesh.mesh.vertices.size() == mesh.mesh.vertices.size());
+	for (size_t i = 0; i < mesh.mesh.vertices.size(); i++)
+		CHECK(lazy_mesh.mesh.vertices[i].position == mesh.mesh.vertices[i].position);
+
+	// The mapped file is released along with the font faces.
+	CHECK(mapping_file_interface.num_unmapped_files == 0);
+	TestsShell::ShutdownShell();
+	CHECK(mapping_file_interface.num_unmapped_files == 1);
+}
@@ -138,3 +138,122 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+			width: 500px;
+			height: 400px;
+		}
+		#boundary {
+			width: 200px;
+			height: 100px;
+			overflow: auto;
+		}
+		#positioned {
+			position: absolute;
+			top: 0;
+			right: 0;
+		}
+	</style>
+</head>
+
+<body>
+	<p id="before">Before</p>
+	<div id="boundary"><p id="content">Content</p></div>
+	<p id="after">After</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* boundary = document->GetElementById("boundary");
+	Element* content = document->GetElementById("content");
+	Element* after = document->GetElementById("after");
+	REQUIRE(boundary);
+	REQUIRE(content);
+	REQUIRE(after);
+
+	TestsShell::RenderLoop();
+
+	const Vector2f boundary_size = boundary->GetBox().GetSize();
+	const Vector2f after_position = after->GetAbsoluteOffset();
+	const float content_height = content->GetBox().GetSize().y;
+	CHECK(boundary->GetScrollHeight() == boundary->GetClientHeight());
+
+	auto CheckLayout = [&]() {
+		// The boundary and elements outside it should not be affected by changes to its contents.
+		CHECK(boundary->GetBox().GetSize() == boundary_size);
+		CHECK(after->GetAbsoluteOffset() == after_position);
+
+		// Compare the contained layout to a full document layout.
+		const Box content_box = content->GetBox();
+		const Vector2f content_position = content->GetAbsoluteOffset();
+		const float scroll_height = boundary->GetScrollHeight();
+
+		document->SetProperty("width", "500px");
+		TestsShell::RenderLoop();
+
+		CHECK(content->GetBox() == content_box);
+		CHECK(content->GetAbsoluteOffset() == content_position);
+		CHECK(boundary->GetScrollHeight() == scroll_height);
+	};
+
+	SUBCASE("Contents")
+	{
+		content->SetInnerRML("Line<br/>Line<br/>Line<br/>Line<br/>Line<br/>Line<br/>Line<br/>Line");
+		TestsShell::RenderLoop();
+
+		CHECK(content->GetBox().GetSize().y > content_height);
+		CHECK(boundary->GetScrollHeight() > boundary->GetClientHeight());
+		CheckLayout();
+	}
+
+	SUBCASE("Child")
+	{
+		Element* child = boundary->AppendChild(document->CreateElement("p"));
+		child->SetInnerRML("Appended");
+		TestsShell::RenderLoop();
+
+		CHECK(child->GetAbsoluteOffset().y > content->GetAbsoluteOffset().y);
+		CheckLayout();
+	}
+
+	SUBCASE("PositionedOutside")
+	{
+		// The containing block of this element is outside the boundary, so the whole document must be formatted.
+		Element* child = content->AppendChild(document->CreateElement("div"));
+		child->SetId("positioned");
+		child->SetInnerRML("Positioned");
+		TestsShell::RenderLoop();
+
+		CHECK(child->GetBox().GetSize().x > 0.f);
+		CheckLayout();
+	}
+
+	SUBCASE("BoundarySize")
+	{
+		// Changing the boundary's own size should still affect the layout of its siblings.
+		boundary->SetProperty("height", "150px");
+		TestsShell::RenderLoop();
+
+		CHECK(boundary->GetBox().GetSize().y == 150.f);
+		CHECK(after->GetAbsoluteOffset().y == after_position.y + 50.f);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
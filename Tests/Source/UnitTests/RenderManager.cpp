@@ -0,0 +1,295 @@
+﻿/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019-2023 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementText.h>
+#include <RmlUi/Core/RenderManager.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_batching_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		div {
+			height: 20px;
+			border: 1px #ccc;
+			background-color: #333;
+		}
+		#scroll {
+			height: 100px;
+			overflow: auto;
+		}
+		.rotate {
+			transform: rotate(10deg);
+		}
+	</style>
+</head>
+
+<body>
+<div/>
+<div/>
+<div>Text</div>
+<div id="scroll">
+	<div/>
+	<div/>
+	<div class="rotate"/>
+	<div/>
+	<div/>
+	<div/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("RenderManager.GeometryBatching")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	RenderManager& render_manager = context->GetRenderManager();
+	REQUIRE(!render_manager.IsGeometryBatchingEnabled());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = render_interface->GetCounters();
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return counters;
+	};
+
+	// Render twice so that all geometry is compiled, and no further compile calls are made without batching.
+	RenderFrame();
+	const auto unbatched = RenderFrame();
+	REQUIRE(unbatched.render_geometry > 0);
+	CHECK(unbatched.compile_geometry == 0);
+
+	render_manager.EnableGeometryBatching(true);
+	const auto batched = RenderFrame();
+
+	// Consecutive geometry with the same texture and render state is merged, so fewer draw calls are issued while
+	// submitting exactly the same triangles.
+	CHECK(batched.render_geometry < unbatched.render_geometry);
+	CHECK(batched.render_geometry > 1);
+	CHECK(batched.render_indices == unbatched.render_indices);
+
+	// Merged geometry is compiled every frame, and released at the start of the next frame.
+	CHECK(batched.compile_geometry > 0);
+	CHECK(batched.release_geometry == 0);
+
+	const auto batched_next = RenderFrame();
+	CHECK(batched_next.render_geometry == batched.render_geometry);
+	CHECK(batched_next.render_indices == batched.render_indices);
+	CHECK(batched_next.compile_geometry == batched.compile_geometry);
+	CHECK(batched_next.release_geometry == batched.compile_geometry);
+
+	// State changes must be submitted in the same order relative to the geometry.
+	CHECK(batched_next.set_transform == unbatched.set_transform);
+	CHECK(batched_next.set_scissor == unbatched.set_scissor);
+
+	render_manager.EnableGeometryBatching(false);
+	const auto unbatched_next = RenderFrame();
+	CHECK(unbatched_next.render_geometry == unbatched.render_geometry);
+	CHECK(unbatched_next.render_indices == unbatched.render_indices);
+	CHECK(unbatched_next.release_geometry == batched.compile_geometry);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_batching_text_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+	</style>
+</head>
+
+<body>
+<p>First <span>second</span> third <span>fourth</span> fifth</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("RenderManager.GeometryBatchingText")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	RenderManager& render_manager = context->GetRenderManager();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_batching_text_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const auto& counters = render_interface->GetCounters();
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		return counters;
+	};
+
+	RenderFrame();
+	const auto unbatched = RenderFrame();
+	CHECK(unbatched.render_geometry == 5);
+
+	// All the text nodes are rendered from the same font texture, which has already been generated, so their draws should be merged.
+	render_manager.EnableGeometryBatching(true);
+	const auto batched = RenderFrame();
+	CHECK(batched.render_geometry == 1);
+	CHECK(batched.render_indices == unbatched.render_indices);
+
+	render_manager.EnableGeometryBatching(false);
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_glyph_instancing_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		div {
+			color: #f00;
+			font-effect: shadow(2px 2px #00f);
+		}
+	</style>
+</head>
+
+<body>
+<div id="text">Hello world</div>
+</body>
+</rml>
+)";
+
+class GlyphInstancingRenderInterface : public TestsRenderInterface {
+public:
+	bool IsGlyphInstancingSupported() override { return true; }
+	CompiledGeometryHandle CompileGlyphInstances(Span<const GlyphInstance> instances) override
+	{
+		num_compiled_lists += 1;
+		num_compiled_instances += (int)instances.size();
+		return CompiledGeometryHandle(num_compiled_lists);
+	}
+	void RenderGlyphInstances(CompiledGeometryHandle /*instances*/, Vector2f /*translation*/, TextureHandle texture,
+		ColourbPremultiplied colour) override
+	{
+		CHECK(texture);
+		rendered_colours.push_back(colour);
+	}
+	void ReleaseGlyphInstances(CompiledGeometryHandle /*instances*/) override { num_released_lists += 1; }
+
+	int num_compiled_lists = 0;
+	int num_compiled_instances = 0;
+	int num_released_lists = 0;
+	Vector<ColourbPremultiplied> rendered_colours;
+};
+
+TEST_CASE("RenderManager.GlyphInstancing")
+{
+	GlyphInstancingRenderInterface render_interface;
+	Context* context = TestsShell::GetContext(true, &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_glyph_instancing_rml);
+	REQUIRE(document);
+	document->Show();
+	Element* element = document->GetElementById("text");
+
+	auto RenderFrame = [&]() {
+		context->Update();
+		render_interface.rendered_colours.clear();
+		context->Render();
+		return render_interface.rendered_colours;
+	};
+
+	auto Contains = [](const Vector<ColourbPremultiplied>& colours, ColourbPremultiplied colour) {
+		return std::find(colours.begin(), colours.end(), colour) != colours.end();
+	};
+
+	RenderFrame();
+	REQUIRE(context->GetRenderManager().IsGlyphInstancingSupported());
+
+	// The text and its shadow are rendered as separate instance lists, tinted by the text colour and its opacity, respectively.
+	const Vector<ColourbPremultiplied> colours = RenderFrame();
+	REQUIRE(colours.size() == 2);
+	CHECK(Contains(colours, ColourbPremultiplied(255, 0, 0, 255)));
+	CHECK(Contains(colours, ColourbPremultiplied(255, 255, 255, 255)));
+	CHECK(render_interface.num_compiled_instances > 10);
+
+	// Changing the colour or opacity only changes the colour the instances are rendered with.
+	const int num_compiled_lists = render_interface.num_compiled_lists;
+	element->SetProperty("color", "#0f0");
+	const Vector<ColourbPremultiplied> colours_green = RenderFrame();
+	CHECK(Contains(colours_green, ColourbPremultiplied(0, 255, 0, 255)));
+
+	element->SetProperty("opacity", "0.5");
+	const Vector<ColourbPremultiplied> colours_opacity = RenderFrame();
+	CHECK(Contains(colours_opacity, Colourb(0, 255, 0).ToPremultiplied(0.5f)));
+	CHECK(Contains(colours_opacity, Colourb(255, 255, 255).ToPremultiplied(0.5f)));
+	CHECK(render_interface.num_compiled_lists == num_compiled_lists);
+
+	// Changing the text generates new instances.
+	rmlui_dynamic_cast<ElementText*>(element->GetFirstChild())->SetText("Hello");
+	RenderFrame();
+	CHECK(render_interface.num_compiled_lists > num_compiled_lists);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+
+	CHECK(render_interface.num_released_lists == render_interface.num_compiled_lists);
+}
@@ -31,6 +31,7 @@
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StyleSheet.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 
@@ -458,3 +459,303 @@ TEST_CASE("Selectors")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_ancestor_names_rml = R"(
+<rml>
+<head>
+	<style>
+		.a .target { width: 10px; }
+		.b > div .target { width: 20px; }
+		#c + div .target { width: 30px; }
+		p .target { width: 40px; }
+	</style>
+</head>
+<body>
+<div id="outer">
+	<div id="inner">
+		<div id="target" class="target"/>
+	</div>
+</div>
+<div id="sibling"/>
+<div id="next"/>
+<p id="paragraph"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Selectors.ancestor_names")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_ancestor_names_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* outer = document->GetElementById("outer");
+	Element* target = document->GetElementById("target");
+
+	// Selectors with descendant and child combinators must be re-evaluated whenever the names of any ancestors change.
+	auto GetWidth = [&]() {
+		context->Update();
+		return target->GetProperty<float>("width");
+	};
+	CHECK(GetWidth() == 0.f);
+
+	outer->SetClass("a", true);
+	CHECK(GetWidth() == 10.f);
+
+	outer->SetClass("a", false);
+	outer->SetClass("b", true);
+	CHECK(GetWidth() == 20.f);
+
+	outer->SetClass("b", false);
+	CHECK(GetWidth() == 0.f);
+
+	// Ancestors matched through a sibling combinator.
+	document->GetElementById("sibling")->SetId("c");
+	CHECK(GetWidth() == 0.f);
+	document->GetElementById("next")->AppendChild(outer->RemoveChild(outer->GetFirstChild()));
+	CHECK(GetWidth() == 30.f);
+
+	// Moving the element between ancestors.
+	document->GetElementById("paragraph")->AppendChild(target->GetParentNode()->RemoveChild(target));
+	CHECK(GetWidth() == 40.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_style_sharing_rml = R"(
+<rml>
+<head>
+	<style>
+		body { font-family: LatoLatin; }
+		.row { width: 10px; height: 10px; }
+		.row.active { width: 20px; }
+		.row:hover { width: 30px; }
+		.cell:nth-child(2) { height: 20px; }
+		.cell[selected] { height: 30px; }
+		.item + .item { height: 40px; }
+	</style>
+</head>
+<body>
+<div id="list">
+	<div class="row"/>
+	<div class="row"/>
+	<div class="row active"/>
+	<div class="row"/>
+	<div class="row"/>
+</div>
+<div id="cells">
+	<div class="cell"/>
+	<div class="cell"/>
+	<div class="cell"/>
+	<div class="cell" selected/>
+	<div class="cell"/>
+</div>
+<div id="items">
+	<div class="item"/>
+	<div class="item"/>
+	text
+	<div class="item"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Selectors.style_sharing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_style_sharing_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	// Siblings with equal names may share their definitions, make sure they are still styled correctly in the presence of selectors that can
+	// tell them apart.
+	auto GetSizes = [&](const String& parent_id, const char* property) {
+		context->Update();
+		String result;
+		Element* parent = document->GetElementById(parent_id);
+		for (int i = 0; i < parent->GetNumChildren(); i++)
+		{
+			Element* child = parent->GetChild(i);
+			if (child->GetTagName() != "#text")
+				result += ToString(child->GetProperty<float>(property)) + " ";
+		}
+		return result;
+	};
+
+	CHECK(GetSizes("list", "width") == "10 10 20 10 10 ");
+	CHECK(GetSizes("cells", "height") == "0 20 0 30 0 ");
+	CHECK(GetSizes("items", "height") == "0 40 40 ");
+
+	Element* list = document->GetElementById("list");
+	list->GetChild(1)->SetPseudoClass("hover", true);
+	list->GetChild(2)->SetClass("active", false);
+	CHECK(GetSizes("list", "width") == "10 30 10 10 10 ");
+
+	list->GetChild(1)->SetPseudoClass("hover", false);
+	list->GetChild(3)->SetClass("active", true);
+	CHECK(GetSizes("list", "width") == "10 10 10 20 10 ");
+
+	Element* cells = document->GetElementById("cells");
+	cells->RemoveChild(cells->GetChild(0));
+	cells->GetChild(3)->SetAttribute("selected", "");
+	CHECK(GetSizes("cells", "height") == "0 20 30 30 ");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+#ifdef RMLUI_STYLESHEET_MATCHING_STATISTICS
+
+TEST_CASE("Selectors.class_index")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// The class 'btn' is used by many rules, while 'common' is used by many rules but not by the target element.
+	String rules = "body { font-family: LatoLatin; }\n .btn { width: 5px; }\n .x3.common { height: 10px; }\n";
+	for (int i = 1; i <= 20; i++)
+		rules += CreateString(".btn.x%d { width: 10px; }\n .common.y%d { height: 20px; }\n", i, i);
+
+	const String document_rml = "<rml><head><style>" + rules + "</style></head><body><div id='target' class='btn x3'/></body></rml>";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* target = document->GetElementById("target");
+	CHECK(target->GetProperty<float>("width") == 10.f);
+	CHECK(target->GetProperty<float>("height") == 0.f);
+
+	const StyleSheet* style_sheet = document->GetStyleSheet();
+	REQUIRE(style_sheet);
+
+	const StyleSheet::MatchingStatistics before = style_sheet->GetMatchingStatistics();
+	target->SetClass("x3", false);
+	target->SetClass("x3", true);
+	context->Update();
+
+	// Nodes should be indexed by their rarest class, so only '.btn', '.btn.x3', and '.x3.common' are candidates for the target. Of those,
+	// '.x3.common' is ruled out by the name filter, without matching it against the element.
+	const StyleSheet::MatchingStatistics& statistics = style_sheet->GetMatchingStatistics();
+	CHECK(statistics.num_lookups - before.num_lookups == 1);
+	CHECK(statistics.num_candidate_nodes - before.num_candidate_nodes == 3);
+	CHECK(statistics.num_tested_nodes - before.num_tested_nodes == 2);
+	CHECK(statistics.num_matched_nodes - before.num_matched_nodes == 2);
+	CHECK(target->GetProperty<float>("width") == 10.f);
+	CHECK(target->GetProperty<float>("height") == 0.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_invalidation_sets_rml = R"(
+<rml>
+<head>
+	<style>
+		body { font-family: LatoLatin; }
+		.self { width: 10px; }
+		.ancestor .child { width: 20px; }
+		.previous + .next { width: 30px; }
+		div:checked { height: 10px; }
+		.trigger:checked + div { width: 40px; }
+		.x:not(.negated) { height: 20px; }
+		[data-attr] { height: 30px; }
+	</style>
+</head>
+<body>
+<div id="parent">
+	<div id="first" class="child"/>
+	<div id="second" class="next"/>
+</div>
+<div id="other" class="x"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Selectors.invalidation_sets")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_invalidation_sets_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const StyleSheet* style_sheet = document->GetStyleSheet();
+	REQUIRE(style_sheet);
+
+	Element* parent = document->GetElementById("parent");
+	Element* first = document->GetElementById("first");
+	Element* second = document->GetElementById("second");
+	Element* other = document->GetElementById("other");
+
+	// Returns the number of elements whose definition was looked up during the update.
+	auto Update = [&]() {
+		const size_t num_lookups = style_sheet->GetMatchingStatistics().num_lookups;
+		context->Update();
+		return style_sheet->GetMatchingStatistics().num_lookups - num_lookups;
+	};
+
+	// Names not used in any selector should not cause any elements to be restyled.
+	parent->SetClass("unused", true);
+	CHECK(Update() == 0);
+	parent->SetPseudoClass("unused", true);
+	CHECK(Update() == 0);
+	parent->SetAttribute("unused", "");
+	CHECK(Update() == 0);
+
+	// Only the element itself should be restyled.
+	parent->SetClass("self", true);
+	CHECK(Update() == 1);
+	CHECK(parent->GetProperty<float>("width") == 10.f);
+
+	// The pseudo class is also used with a sibling combinator, but only together with a class not set on this element.
+	parent->SetPseudoClass("checked", true);
+	CHECK(Update() == 1);
+	CHECK(parent->GetProperty<float>("height") == 10.f);
+
+	other->SetClass("negated", true);
+	CHECK(Update() == 1);
+	CHECK(other->GetProperty<float>("height") == 0.f);
+
+	other->SetAttribute("data-attr", "");
+	CHECK(Update() == 1);
+	CHECK(other->GetProperty<float>("height") == 30.f);
+
+	// Only the descendants should be restyled.
+	parent->SetClass("ancestor", true);
+	CHECK(Update() == 2);
+	CHECK(first->GetProperty<float>("width") == 20.f);
+
+	// The siblings should be restyled.
+	first->SetClass("previous", true);
+	CHECK(Update() == 2);
+	CHECK(second->GetProperty<float>("width") == 30.f);
+
+	// Both changes affect the same elements, they should only be restyled once.
+	first->SetClass("previous", false);
+	parent->SetClass("ancestor", false);
+	CHECK(Update() == 2);
+	CHECK(first->GetProperty<float>("width") == 0.f);
+	CHECK(second->GetProperty<float>("width") == 0.f);
+
+	first->SetClass("trigger", true);
+	CHECK(Update() == 2);
+	first->SetPseudoClass("checked", true);
+	CHECK(Update() == 2);
+	CHECK(second->GetProperty<float>("width") == 40.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+#endif